@@ -71,6 +71,12 @@ SOURCES += main.cpp \
            editseriesdialog.cpp \
            runguard.cpp \
            dashboard.cpp \
+           compositor.cpp \
+           triggermatcher.cpp \
+           compiledstyle.cpp \
+           transition.cpp \
+           frameclock.cpp \
+           reportsplitter.cpp \
 
 HEADERS  += mainwindow.h \
             types.h \
@@ -94,6 +100,13 @@ HEADERS  += mainwindow.h \
             runguard.h \
             dashboard.h \
             lanedata.h \
+            compositor.h \
+            triggermatcher.h \
+            compiledstyle.h \
+            transition.h \
+            frameclock.h \
+            handletable.h \
+            reportsplitter.h \
 
 # Plug-in interface
 HEADERS += \
@@ -5,3 +5,4 @@ SUBDIRS += ./Newsroom.pro \
            reporters/REST/TeamCity9 \
            reporters/REST/YahooChartAPI \
            reporters/Local/TextFile \
+           tests \
@@ -67,6 +67,7 @@ AddStoryDialog::AddStoryDialog(BeatsMap &beats_map,
 
     QRegExp rx("\\d+");
     ui->edit_TTL->setValidator(new QRegExpValidator(rx, this));
+    ui->edit_QueueLimit->setValidator(new QRegExpValidator(rx, this));
 //    ui->edit_HeadlinesFixedWidth->setValidator(new QRegExpValidator(rx, this));
 //    ui->edit_HeadlinesFixedHeight->setValidator(new QRegExpValidator(rx, this));
     ui->edit_LimitContent->setValidator(new QRegExpValidator(rx, this));
@@ -175,6 +176,12 @@ void AddStoryDialog::save_settings()
         story_info->ttl = static_cast<uint>(ui->edit_TTL->text().toInt());
     else
         story_info->ttl = static_cast<uint>(ui->edit_TTL->placeholderText().toInt());
+    if(!ui->edit_QueueLimit->text().isEmpty())
+        story_info->queue_limit = ui->edit_QueueLimit->text().toInt();
+    else
+        story_info->queue_limit = ui->edit_QueueLimit->placeholderText().toInt();
+    story_info->queue_overflow = static_cast<QueueOverflow>(ui->combo_QueueOverflow->currentIndex());
+    story_info->coalesce = ui->check_Coalesce->isChecked();
     story_info->headlines_always_visible = ui->check_KeepOnTop->isChecked();
     story_info->primary_screen = ui->radio_Monitor1->isChecked() ? 0 : (ui->radio_Monitor2->isChecked() ? 1 : (ui->radio_Monitor3->isChecked() ? 2 : 3));
     if(ui->radio_InterpretAsPixels->isChecked())
@@ -305,6 +312,12 @@ void AddStoryDialog::load_settings()
         ui->edit_TTL->setText(QString());
     else
         ui->edit_TTL->setText(QString::number(story_info->ttl));
+    if(story_info->queue_limit)
+        ui->edit_QueueLimit->setText(QString::number(story_info->queue_limit));
+    else
+        ui->edit_QueueLimit->setText(QString());
+    ui->combo_QueueOverflow->setCurrentIndex(static_cast<int>(story_info->queue_overflow));
+    ui->check_Coalesce->setChecked(story_info->coalesce);
     ui->check_KeepOnTop->setChecked(story_info->headlines_always_visible);
 
     set_display();
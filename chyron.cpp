@@ -13,20 +13,24 @@
 #include "highlightwidget.h"
 #endif
 
+// maximum number of backlogged Headlines a train will absorb in a
+// single aging cycle
+const int MaxTrainBatch = 8;
+
 Chyron::Chyron(StoryInfoPointer story_info, LaneManagerPointer lane_manager, QObject* parent)
     : QObject(parent),
       story_info(story_info),
       lane_manager(lane_manager)
 {
-    age_timer = new QTimer(this);
-    age_timer->setInterval(100);
-    connect(age_timer, &QTimer::timeout, this, &Chyron::slot_age_headlines);
+    // aging is deadline-driven, so nothing else is guaranteed to close
+    // a rate window once Headlines stop arriving
+    rate_timer.setInterval(1000);
+    connect(&rate_timer, &QTimer::timeout, this, &Chyron::slot_update_headline_rate);
 }
 
 Chyron::~Chyron()
 {
     hide();
-    age_timer->deleteLater();
 }
 
 void Chyron::display()
@@ -37,24 +41,20 @@ void Chyron::display()
     highlight = new HighlightWidget();
 #endif
 
-    if(age_timer && !age_timer->isActive())
-        age_timer->start();
-
     visible = true;
+
+    schedule_aging();
 }
 
 void Chyron::hide()
 {
-    if(age_timer)
-        age_timer->stop();
-
+    lane_manager->unschedule(this);
     lane_manager->unsubscribe(this);
 }
 
 void Chyron::shelve()
 {
-    if(age_timer)
-        age_timer->stop();
+    lane_manager->unschedule(this);
 
     visible = false;
     lane_manager->shelve(this);
@@ -68,6 +68,8 @@ void Chyron::suspend()
 void Chyron::resume()
 {
     suspended = false;
+
+    schedule_aging();
 }
 
 void Chyron::unsubscribed()
@@ -77,11 +79,11 @@ void Chyron::unsubscribed()
         highlight->deleteLater();
 #endif
 
+    // the lane is gone, so let go of its Headlines (the HeadlinePool
+    // can't recycle one while its state here still holds it)
     foreach(auto headline, headline_list)
-    {
-        headline->hide();
-        headline.clear();
-    }
+        headline_removed(headline);
+    headline_list.clear();
 
     visible = false;
     suspended = false;
@@ -89,24 +91,21 @@ void Chyron::unsubscribed()
 
 void Chyron::highlight_headline(HeadlinePointer hl, qreal opacity, int timeout)
 {
-    foreach(auto headline, headline_list)
-    {
-        if(headline.data() == hl.data())
-        {
-            if(timeout == 0)
-                // no animation required
-                headline->setWindowOpacity(opacity < 0.0 ? 0.0 : ((opacity > 1.0) ? 1.0 : opacity));
-            else
-            {
-                auto animation = new QPropertyAnimation(headline.data(), "windowOpacity");
-                animation->setDuration(timeout);
-                animation->setStartValue(headline->windowOpacity());
-                animation->setEndValue(opacity < 0.0 ? 0.0 : ((opacity > 1.0) ? 1.0 : opacity));
-                animation->setEasingCurve(story_info->fading_curve);
+    // only Headlines currently posted by this Chyron can be highlighted
+    if(hl.isNull() || !headline_states.value(hl->get_handle()).posted)
+        return;
 
-                animation->start(QAbstractAnimation::DeleteWhenStopped);
-            }
-        }
+    if(timeout == 0)
+    {
+        // no animation required
+        hl->setWindowOpacity(opacity < 0.0 ? 0.0 : ((opacity > 1.0) ? 1.0 : opacity));
+        hl->notify_compositor();
+    }
+    else
+    {
+        auto transition = new Transition(timeout, story_info->fading_curve);
+        transition->fade(hl.data(), hl->windowOpacity(), opacity < 0.0 ? 0.0 : ((opacity > 1.0) ? 1.0 : opacity));
+        transition->start(QAbstractAnimation::DeleteWhenStopped);
     }
 }
 
@@ -124,6 +123,12 @@ void Chyron::initialize_headline(HeadlinePointer headline)
 
     const auto& lane_position = lane_manager->get_base_lane_position(this);
 
+    // lane positions have exclusive right and bottom edges (see lane_rect())
+    auto lane_left = lane_position.x();
+    auto lane_top = lane_position.y();
+    auto lane_right = lane_position.x() + lane_position.width();
+    auto lane_bottom = lane_position.y() + lane_position.height();
+
     auto x{0};
     auto y{0};
     auto width{0};
@@ -151,149 +156,134 @@ void Chyron::initialize_headline(HeadlinePointer headline)
     {
         case AnimEntryType::SlideDownLeftTop:
         case AnimEntryType::TrainDownLeftTop:
-            y = lane_position.top() - height;
-            x = lane_position.left() + story_info->margin;
+            y = lane_top - height;
+            x = lane_left + story_info->margin;
             break;
         case AnimEntryType::SlideDownCenterTop:
         case AnimEntryType::TrainDownCenterTop:
-            y = lane_position.top() - height;
-            // left() is already positioned in the center
-            x = lane_position.left() - (width / 2);
+            y = lane_top - height;
+            // lane_left is already positioned in the center
+            x = lane_left - (width / 2);
             break;
         case AnimEntryType::SlideDownRightTop:
         case AnimEntryType::TrainDownRightTop:
-            y = lane_position.top() - height;
-            x = lane_position.right() - width - story_info->margin;
+            y = lane_top - height;
+            x = lane_right - width - story_info->margin;
             break;
         case AnimEntryType::SlideInLeftTop:
         case AnimEntryType::TrainInLeftTop:
-            y = lane_position.top() + story_info->margin;
-            x = lane_position.left() - width;
+            y = lane_top + story_info->margin;
+            x = lane_left - width;
             break;
         case AnimEntryType::SlideInRightTop:
         case AnimEntryType::TrainInRightTop:
-            y = lane_position.top() + story_info->margin;
-            x = lane_position.right() + width;
+            y = lane_top + story_info->margin;
+            x = lane_right + width;
             break;
         case AnimEntryType::SlideInLeftBottom:
         case AnimEntryType::TrainInLeftBottom:
-            y = lane_position.bottom() - height - story_info->margin;
-            x = lane_position.left() - width;
+            y = lane_bottom - height - story_info->margin;
+            x = lane_left - width;
             break;
         case AnimEntryType::SlideInRightBottom:
         case AnimEntryType::TrainInRightBottom:
-            y = lane_position.bottom() - height - story_info->margin;
-            x = lane_position.right() + width;
+            y = lane_bottom - height - story_info->margin;
+            x = lane_right + width;
             break;
         case AnimEntryType::SlideUpLeftBottom:
         case AnimEntryType::TrainUpLeftBottom:
-            y = lane_position.bottom() + height;
-            x = lane_position.left() + story_info->margin;
+            y = lane_bottom + height;
+            x = lane_left + story_info->margin;
             break;
         case AnimEntryType::SlideUpRightBottom:
         case AnimEntryType::TrainUpRightBottom:
-            y = lane_position.bottom() + height;
-            x = lane_position.right() - width - story_info->margin;
+            y = lane_bottom + height;
+            x = lane_right - width - story_info->margin;
             break;
         case AnimEntryType::SlideUpCenterBottom:
         case AnimEntryType::TrainUpCenterBottom:
-            y = lane_position.bottom() + height;
-            // left() is already positioned in the center
-            x = lane_position.left() - (width / 2);
+            y = lane_bottom + height;
+            // lane_left is already positioned in the center
+            x = lane_left - (width / 2);
             break;
         case AnimEntryType::FadeCenter:
         case AnimEntryType::PopCenter:
-            // top() is already positioned in the center
-            y = lane_position.top() - (height / 2);
-            // left() is already positioned in the center
-            x = lane_position.left() - (width / 2);
+            // lane_top is already positioned in the center
+            y = lane_top - (height / 2);
+            // lane_left is already positioned in the center
+            x = lane_left - (width / 2);
             break;
         case AnimEntryType::FadeLeftTop:
         case AnimEntryType::PopLeftTop:
-            y = lane_position.top() + story_info->margin;
-            x = lane_position.left() + story_info->margin;
+            y = lane_top + story_info->margin;
+            x = lane_left + story_info->margin;
             break;
         case AnimEntryType::FadeRightTop:
         case AnimEntryType::PopRightTop:
-            y = lane_position.top() + story_info->margin;
-            x = lane_position.right() - width - story_info->margin;
+            y = lane_top + story_info->margin;
+            x = lane_right - width - story_info->margin;
             break;
         case AnimEntryType::FadeLeftBottom:
         case AnimEntryType::PopLeftBottom:
-            y = lane_position.bottom() - height - story_info->margin;
-            x = lane_position.left() + story_info->margin;
+            y = lane_bottom - height - story_info->margin;
+            x = lane_left + story_info->margin;
             break;
         case AnimEntryType::FadeRightBottom:
         case AnimEntryType::PopRightBottom:
-            y = lane_position.bottom() - height - story_info->margin;
-            x = lane_position.right() - width - story_info->margin;
+            y = lane_bottom - height - story_info->margin;
+            x = lane_right - width - story_info->margin;
             break;
 
         // the base lane position returned by the Lane Manager is the
         // position of the Chyron in the case of the Dashboard
         case AnimEntryType::DashboardDownLeftTop:
         case AnimEntryType::DashboardInLeftTop:
-            y = lane_position.top() + story_info->margin;
-            x = lane_position.left() + story_info->margin;
+            y = lane_top + story_info->margin;
+            x = lane_left + story_info->margin;
             break;
         case AnimEntryType::DashboardDownRightTop:
         case AnimEntryType::DashboardInRightTop:
-            y = lane_position.top() + story_info->margin;
-            x = lane_position.right() - width - story_info->margin;
+            y = lane_top + story_info->margin;
+            x = lane_right - width - story_info->margin;
             break;
         case AnimEntryType::DashboardInLeftBottom:
         case AnimEntryType::DashboardUpLeftBottom:
-            y = lane_position.bottom() - height - story_info->margin;
-            x = lane_position.left() + story_info->margin;
+            y = lane_bottom - height - story_info->margin;
+            x = lane_left + story_info->margin;
             break;
         case AnimEntryType::DashboardInRightBottom:
         case AnimEntryType::DashboardUpRightBottom:
-            y = lane_position.bottom() - height - story_info->margin;
-            x = lane_position.right() - width - story_info->margin;
+            y = lane_bottom - height - story_info->margin;
+            x = lane_right - width - story_info->margin;
             break;
     }
 
+    headline->set_compositor(lane_manager->get_compositor(story_info->primary_screen, story_info->headlines_always_visible));
     headline->setGeometry(x, y, width, height);
     headline->initialize(story_info->headlines_always_visible, story_info->headlines_fixed_type, width, height);
     if(IS_DASHBOARD(story_info->entry_type) && headline_list.count())
         headline->bottom_window = headline_list.back().data();
 
     // update lane's boundaries (this updates the data in the
-    // Lane Manager for lower-priority lanes to reference)
+    // Lane Manager for lower-priority lanes to reference).
+    //
+    // Headlines in a lane are ordered along its direction of travel,
+    // so the lane's extent is bounded by the entering Headline and the
+    // two ends of the lane; the rest of them never need to be visited.
 
-    auto& lane_boundaries = lane_manager->get_lane_boundaries(this);
+    QRect extent(x, y, width, height);
+    if(headline_list.count())
+        extent = extent.united(headline_list.front()->geometry()).united(headline_list.back()->geometry());
 
-    foreach(auto headline, headline_list)
-    {
-        auto r = headline->geometry();
-        if(r.x() < lane_boundaries.left())
-            lane_boundaries.setLeft(r.x());
-        if(r.y() < lane_boundaries.top())
-            lane_boundaries.setTop(r.y());
-        if((r.x() + r.width()) > lane_boundaries.right())
-            lane_boundaries.setRight(r.x() + r.width());
-        if((r.y() + r.height()) > lane_boundaries.bottom())
-            lane_boundaries.setBottom(r.y() + r.height());
-    }
+    // the lane position and the Headline extent are both measured with
+    // exclusive right and bottom edges, so the boundaries are exact: a
+    // lane is as deep as its Headlines (and their margin), and no more
 
-    if(x < lane_boundaries.left())
-        lane_boundaries.setLeft(x);
-    if(y < lane_boundaries.top())
-        lane_boundaries.setTop(y);
-    if((x + width) > lane_boundaries.right())
-        lane_boundaries.setRight(x + width);
-    if((y + height) > lane_boundaries.bottom())
-        lane_boundaries.setBottom(y + height);
-
-    // there's a calculation error somewhere that is causing
-    // the width/height values to exceed the correct values
-    // by 1.  it manifests when Chyrons are animated by the
-    // LaneManager.  until I can track that down, this puts
-    // a band-aid on it.
-
-    // TODO: Locate the 1-off calculation error.
-    lane_boundaries.setWidth(qMin(width + story_info->margin, lane_boundaries.width()));
-    lane_boundaries.setHeight(qMin(height + story_info->margin, lane_boundaries.height()));
+    auto& lane_boundaries = lane_manager->get_lane_boundaries(this);
+    lane_boundaries = lane_rect(qMin(lane_left, extent.x()),
+                                qMin(lane_top, extent.y()),
+                                qMax(lane_right, extent.x() + extent.width()),
+                                qMax(lane_bottom, extent.y() + extent.height()));
 
 #ifdef HIGHLIGHT_LANES
     highlight->setGeometry(lane_boundaries);
@@ -308,11 +298,15 @@ void Chyron::start_headline_entry(HeadlinePointer headline)
 
     auto speed = story_info->anim_motion_duration;
 
-    QParallelAnimationGroup* animation_group{nullptr};
     auto desktop = QApplication::desktop();
     auto r_desktop = desktop->screenGeometry(story_info->primary_screen);
     auto r = headline->geometry();
 
+    // the entering Headline, and any already-posted Headlines it pushes
+    // along, all move as tracks of a single Transition
+
+    auto transition = new Transition(speed, story_info->motion_curve);
+
     switch(story_info->entry_type)
     {
         case AnimEntryType::SlideDownLeftTop:
@@ -335,24 +329,7 @@ void Chyron::start_headline_entry(HeadlinePointer headline)
         case AnimEntryType::TrainUpLeftBottom:
         case AnimEntryType::TrainUpRightBottom:
         case AnimEntryType::TrainUpCenterBottom:
-            headline->animation = AnimationPointer(new QPropertyAnimation(headline.data(), "geometry"),
-                                [] (QAbstractAnimation* anim) { anim->deleteLater(); });
-            headline->animation->setDuration(speed);
-            headline->animation->setStartValue(QRect(r.x(), r.y(), r.width(), r.height()));
-            headline->animation->setEasingCurve(story_info->motion_curve);
-            connect(headline->animation.data(), &QPropertyAnimation::finished, this, &Chyron::slot_headline_posted);
-            prop_anim_map[headline->animation.data()] = headline;
-
-            if(headline_list.length())
-            {
-                animation_group = new QParallelAnimationGroup();
-                foreach(auto posted_headline, headline_list)
-                    posted_headline->animation = AnimationPointer(new QPropertyAnimation(posted_headline.data(), "geometry"),
-                                [] (QAbstractAnimation* anim) { anim->deleteLater(); });
-
-                if(IS_TRAIN(story_info->entry_type))
-                    connect(animation_group, &QParallelAnimationGroup::finished, this, &Chyron::slot_train_expire_headlines);
-            }
+            // tracks are added below by calculate_entry_motion()
             break;
 
         case AnimEntryType::PopCenter:
@@ -360,18 +337,8 @@ void Chyron::start_headline_entry(HeadlinePointer headline)
         case AnimEntryType::PopRightTop:
         case AnimEntryType::PopLeftBottom:
         case AnimEntryType::PopRightBottom:
-            // create a dummy effect for these types so slot_headline_posted()
-            // is triggered
-            headline->animation.clear();
-            headline->animation = AnimationPointer(new QPropertyAnimation(headline.data(), "geometry"),
-                                [] (QAbstractAnimation* anim) { anim->deleteLater(); });
-            headline->animation->setDuration(speed);
-            headline->animation->setStartValue(QRect(r.x(), r.y(), r.width(), r.height()));
-            headline->animation->setEndValue(QRect(r.x(), r.y(), r.width(), r.height()));
-            headline->animation->setEasingCurve(story_info->motion_curve);
-            connect(headline->animation.data(), &QPropertyAnimation::finished, this, &Chyron::slot_headline_posted);
-            prop_anim_map[headline->animation.data()] = headline;
-            entering_map[headline] = true;
+            // the Transition has no tracks for these types; it just
+            // runs for its duration so slot_headline_posted() is triggered
             break;
 
         case AnimEntryType::DashboardDownLeftTop:
@@ -382,7 +349,7 @@ void Chyron::start_headline_entry(HeadlinePointer headline)
         case AnimEntryType::DashboardInRightBottom:
         case AnimEntryType::DashboardUpLeftBottom:
         case AnimEntryType::DashboardUpRightBottom:
-            headline->animation.clear();
+            delete transition;
             headline->viewed = QDateTime::currentDateTime().toTime_t();
             headline->show();
             // slot_headline_posted() will never be hit with this, so the
@@ -396,25 +363,44 @@ void Chyron::start_headline_entry(HeadlinePointer headline)
         case AnimEntryType::FadeRightTop:
         case AnimEntryType::FadeLeftBottom:
         case AnimEntryType::FadeRightBottom:
-            {
-                headline->animation = AnimationPointer(new QPropertyAnimation(headline.data(), "windowOpacity"),
-                                [] (QAbstractAnimation* anim) { anim->deleteLater(); });
-                headline->animation->setDuration(speed);
-                headline->animation->setStartValue(0.0);
-                headline->animation->setEndValue(1.0);
-                headline->animation->setEasingCurve(story_info->motion_curve);
-                connect(headline->animation.data(), &QPropertyAnimation::finished, this, &Chyron::slot_headline_posted);
-                prop_anim_map[headline->animation.data()] = headline;
-            }
+            transition->fade(headline.data(), 0.0, 1.0);
             break;
     }
 
-    auto configure_group_item = [](QPropertyAnimation* anim, int speed, const QRect& start, const QRect& end, QEasingCurve curve) {
-        anim->setDuration(speed);
-        anim->setStartValue(start);
-        anim->setEndValue(end);
-        anim->setEasingCurve(curve);
-    };
+    QRect target;
+    QPoint shift;
+    if(calculate_entry_motion(r, r_desktop, target, shift))
+    {
+        transition->move(headline.data(), r, target);
+
+        foreach(auto posted_headline, headline_list)
+        {
+            QRect posted_r = posted_headline->geometry();
+            transition->move(posted_headline.data(), posted_r, posted_r.translated(shift));
+        }
+    }
+
+    connect(transition, &Transition::finished, this, &Chyron::slot_headline_posted);
+    if(IS_TRAIN(story_info->entry_type) && headline_list.length())
+        connect(transition, &Transition::finished, this, &Chyron::slot_train_expire_headlines);
+    transition->set_handle(headline->get_handle());
+
+    headline->viewed = QDateTime::currentDateTime().toTime_t();
+    headline->show();
+
+    auto& state = headline_states[headline->get_handle()];
+    state.headline = headline;
+    state.entering = true;
+    ++entering_count;
+
+    lane_manager->anim_queue(this, transition);
+}
+
+bool Chyron::calculate_entry_motion(const QRect& r, const QRect& r_desktop, QRect& target, QPoint& shift) const
+{
+    // determine where an entering Headline comes to rest, and how far
+    // any already-posted Headlines in the lane are pushed to make room
+    // for it.  entry types that do not move return false.
 
     switch(story_info->entry_type)
     {
@@ -424,98 +410,32 @@ void Chyron::start_headline_entry(HeadlinePointer headline)
         case AnimEntryType::TrainDownLeftTop:
         case AnimEntryType::TrainDownCenterTop:
         case AnimEntryType::TrainDownRightTop:
-            headline->animation->setEndValue(QRect(r.x(), r_desktop.top() + story_info->margin, r.width(), r.height()));
-
-            if(animation_group)
-            {
-                foreach(auto posted_headline, headline_list)
-                {
-                    QRect posted_r = posted_headline->geometry();
-                    configure_group_item(posted_headline->animation.data(), speed, posted_r,
-                                         QRect(posted_r.x(), posted_r.y() + r.height() + story_info->margin, posted_r.width(), posted_r.height()),
-                                         story_info->motion_curve);
-                }
-            }
-            break;
+            target = QRect(r.x(), r_desktop.top() + story_info->margin, r.width(), r.height());
+            shift = QPoint(0, r.height() + story_info->margin);
+            return true;
         case AnimEntryType::SlideInLeftTop:
         case AnimEntryType::TrainInLeftTop:
-            headline->animation->setEndValue(QRect(r_desktop.left() + story_info->margin, r.y(), r.width(), r.height()));
-
-            if(animation_group)
-            {
-                foreach(auto posted_headline, headline_list)
-                {
-                    QRect posted_r = posted_headline->geometry();
-                    configure_group_item(posted_headline->animation.data(), speed, posted_r,
-                                         QRect(posted_r.x() + r.width() + story_info->margin, posted_r.y(), posted_r.width(), posted_r.height()),
-                                         story_info->motion_curve);
-                }
-            }
-            break;
-        case AnimEntryType::SlideInRightTop:
-        case AnimEntryType::TrainInRightTop:
-            headline->animation->setEndValue(QRect(r_desktop.width() - r.width() - story_info->margin, r.y(), r.width(), r.height()));
-
-            if(animation_group)
-            {
-                foreach(auto posted_headline, headline_list)
-                {
-                    QRect posted_r = posted_headline->geometry();
-                    configure_group_item(posted_headline->animation.data(), speed, posted_r,
-                                         QRect(posted_r.x() - r.width() - story_info->margin, posted_r.y(), posted_r.width(), posted_r.height()),
-                                         story_info->motion_curve);
-                }
-            }
-            break;
         case AnimEntryType::SlideInLeftBottom:
         case AnimEntryType::TrainInLeftBottom:
-            headline->animation->setEndValue(QRect(r_desktop.left() + story_info->margin, r.y(), r.width(), r.height()));
-
-            if(animation_group)
-            {
-                foreach(auto posted_headline, headline_list)
-                {
-                    QRect posted_r = posted_headline->geometry();
-                    configure_group_item(posted_headline->animation.data(), speed, posted_r,
-                                         QRect(posted_r.x() + r.width() + story_info->margin, posted_r.y(), posted_r.width(), posted_r.height()),
-                                         story_info->motion_curve);
-                }
-            }
-            break;
+            target = QRect(r_desktop.left() + story_info->margin, r.y(), r.width(), r.height());
+            shift = QPoint(r.width() + story_info->margin, 0);
+            return true;
+        case AnimEntryType::SlideInRightTop:
+        case AnimEntryType::TrainInRightTop:
         case AnimEntryType::SlideInRightBottom:
         case AnimEntryType::TrainInRightBottom:
-            headline->animation->setEndValue(QRect(r_desktop.width() - r.width() - story_info->margin, r.y(), r.width(), r.height()));
-
-            if(animation_group)
-            {
-                foreach(auto posted_headline, headline_list)
-                {
-                    QRect posted_r = posted_headline->geometry();
-                    configure_group_item(posted_headline->animation.data(), speed, posted_r,
-                                         QRect(posted_r.x() - r.width() - story_info->margin, posted_r.y(), posted_r.width(), posted_r.height()),
-                                         story_info->motion_curve);
-                }
-            }
-            break;
+            target = QRect(r_desktop.width() - r.width() - story_info->margin, r.y(), r.width(), r.height());
+            shift = QPoint(-(r.width() + story_info->margin), 0);
+            return true;
         case AnimEntryType::SlideUpLeftBottom:
         case AnimEntryType::SlideUpRightBottom:
         case AnimEntryType::SlideUpCenterBottom:
         case AnimEntryType::TrainUpLeftBottom:
         case AnimEntryType::TrainUpRightBottom:
         case AnimEntryType::TrainUpCenterBottom:
-            headline->animation->setEndValue(QRect(r.x(), r_desktop.bottom() - r.height() - story_info->margin, r.width(), r.height()));
-
-            if(animation_group)
-            {
-                foreach(auto posted_headline, headline_list)
-                {
-                    QRect posted_r = posted_headline->geometry();
-                    configure_group_item(posted_headline->animation.data(), speed, posted_r,
-                                         QRect(posted_r.x(), posted_r.y() - r.height() - story_info->margin, posted_r.width(), posted_r.height()),
-                                         story_info->motion_curve);
-                }
-            }
-            break;
+            target = QRect(r.x(), r_desktop.bottom() - r.height() - story_info->margin, r.width(), r.height());
+            shift = QPoint(0, -(r.height() + story_info->margin));
+            return true;
 
         case AnimEntryType::PopCenter:
         case AnimEntryType::PopLeftTop:
@@ -538,23 +458,34 @@ void Chyron::start_headline_entry(HeadlinePointer headline)
             break;
     }
 
-    headline->viewed = QDateTime::currentDateTime().toTime_t();
-    headline->show();
+    return false;
+}
 
-    if(animation_group || headline->animation)
-    {
-        entering_map[headline] = true;
+void Chyron::post_headline_immediately(HeadlinePointer headline)
+{
+    // used to absorb a backlog in a train: the Headline is placed
+    // directly at the head of the lane without animation, pushing
+    // the already-posted Headlines back as though it had entered
+    // normally.  the next animated entry moves the whole batch.
 
-        if(animation_group)
-        {
-            animation_group->addAnimation(headline->animation.data());
-            foreach(auto posted_headline, headline_list)
-                animation_group->addAnimation(posted_headline->animation.data());
-            lane_manager->anim_queue(this, animation_group);
-        }
-        else if(headline->animation)
-            lane_manager->anim_queue(this, headline->animation.data());
-    }
+    if(!visible || suspended)
+        return;
+
+    auto desktop = QApplication::desktop();
+    auto r_desktop = desktop->screenGeometry(story_info->primary_screen);
+
+    QRect target;
+    QPoint shift;
+    if(!calculate_entry_motion(headline->geometry(), r_desktop, target, shift))
+        return;
+
+    foreach(auto posted_headline, headline_list)
+        posted_headline->setGeometry(posted_headline->geometry().translated(shift));
+
+    headline->setGeometry(target);
+    headline->show();
+
+    headline_posted(headline);
 }
 
 void Chyron::start_headline_exit(HeadlinePointer headline)
@@ -564,8 +495,6 @@ void Chyron::start_headline_exit(HeadlinePointer headline)
 
     // the time-to-display has expired
 
-    QParallelAnimationGroup* animation_group{nullptr};
-
     auto desktop = QApplication::desktop();
     auto r_desktop = desktop->screenGeometry(story_info->primary_screen);
     auto r = headline->geometry();
@@ -578,12 +507,9 @@ void Chyron::start_headline_exit(HeadlinePointer headline)
         {
             if(story_info->train_age_effect == AgeEffects::ReduceOpacityFixed)
             {
-                auto animation = new QPropertyAnimation(headline.data(), "windowOpacity");
-                animation->setDuration(speed);
-                animation->setStartValue(1.0);
-                animation->setEndValue(story_info->train_age_percent / 100.0);
-                animation->setEasingCurve(story_info->fading_curve);
-                lane_manager->anim_queue(this, animation);
+                auto transition = new Transition(speed, story_info->fading_curve);
+                transition->fade(headline.data(), 1.0, story_info->train_age_percent / 100.0);
+                lane_manager->anim_queue(this, transition);
             }
         }
 
@@ -595,12 +521,9 @@ void Chyron::start_headline_exit(HeadlinePointer headline)
         {
             if(story_info->dashboard_age_percent)
             {
-                auto animation = new QPropertyAnimation(headline.data(), "windowOpacity");
-                animation->setDuration(speed);
-                animation->setStartValue(1.0);
-                animation->setEndValue(story_info->dashboard_age_percent / 100.0);
-                animation->setEasingCurve(story_info->fading_curve);
-                lane_manager->anim_queue(this, animation);
+                auto transition = new Transition(speed, story_info->fading_curve);
+                transition->fade(headline.data(), 1.0, story_info->dashboard_age_percent / 100.0);
+                lane_manager->anim_queue(this, transition);
             }
         }
 
@@ -608,60 +531,32 @@ void Chyron::start_headline_exit(HeadlinePointer headline)
     }
     else
     {
-        switch(story_info->exit_type)
+        if(story_info->exit_type == AnimExitType::Pop)
         {
-            case AnimExitType::SlideLeft:
-            case AnimExitType::SlideRight:
-            case AnimExitType::SlideUp:
-            case AnimExitType::SlideDown:
-            case AnimExitType::SlideFadeLeft:
-            case AnimExitType::SlideFadeRight:
-            case AnimExitType::SlideFadeUp:
-            case AnimExitType::SlideFadeDown:
-                headline->animation = AnimationPointer(new QPropertyAnimation(headline.data(), "geometry"),
-                                    [] (QAbstractAnimation* anim) { anim->deleteLater(); });
-                headline->animation->setDuration(speed);
-                headline->animation->setStartValue(QRect(r.x(), r.y(), r.width(), r.height()));
-                headline->animation->setEasingCurve(story_info->motion_curve);
-                connect(headline->animation.data(), &QPropertyAnimation::finished, this, &Chyron::slot_headline_expired);
-                prop_anim_map[headline->animation.data()] = headline;
-                break;
-
-            case AnimExitType::Fade:
-                headline->animation = AnimationPointer(new QPropertyAnimation(headline.data(), "windowOpacity"),
-                                    [] (QAbstractAnimation* anim) { anim->deleteLater(); });
-                headline->animation->setDuration(speed);
-                headline->animation->setStartValue(1.0);
-                headline->animation->setEndValue(0.0);
-                headline->animation->setEasingCurve(story_info->motion_curve);
-                connect(headline->animation.data(), &QPropertyAnimation::finished, this, &Chyron::slot_headline_expired);
-                prop_anim_map[headline->animation.data()] = headline;
-                break;
-
-            case AnimExitType::Pop:
-                headline_list.removeAll(headline);
-                headline->hide();
-                headline.clear();
-                break;
+            headline_list.removeAll(headline);
+            headline_removed(headline);
+            return;
         }
 
+        auto transition = new Transition(speed, story_info->motion_curve);
+
         switch(story_info->exit_type)
         {
             case AnimExitType::SlideLeft:
             case AnimExitType::SlideFadeLeft:
-                headline->animation->setEndValue(QRect(r_desktop.x() - r.width(), r.y(), r.width(), r.height()));
+                transition->move(headline.data(), r, QRect(r_desktop.x() - r.width(), r.y(), r.width(), r.height()));
                 break;
             case AnimExitType::SlideRight:
             case AnimExitType::SlideFadeRight:
-                headline->animation->setEndValue(QRect(r_desktop.x() + r_desktop.width() + r.width(), r.y(), r.width(), r.height()));
+                transition->move(headline.data(), r, QRect(r_desktop.x() + r_desktop.width() + r.width(), r.y(), r.width(), r.height()));
                 break;
             case AnimExitType::SlideUp:
             case AnimExitType::SlideFadeUp:
-                headline->animation->setEndValue(QRect(r.x(), r_desktop.y() - r.height(), r.width(), r.height()));
+                transition->move(headline.data(), r, QRect(r.x(), r_desktop.y() - r.height(), r.width(), r.height()));
                 break;
             case AnimExitType::SlideDown:
             case AnimExitType::SlideFadeDown:
-                headline->animation->setEndValue(QRect(r.x(), r_desktop.y() + r_desktop.height() + r.height(), r.width(), r.height()));
+                transition->move(headline.data(), r, QRect(r.x(), r_desktop.y() + r_desktop.height() + r.height(), r.width(), r.height()));
                 break;
 
             case AnimExitType::Fade:
@@ -671,153 +566,71 @@ void Chyron::start_headline_exit(HeadlinePointer headline)
 
         switch(story_info->exit_type)
         {
+            case AnimExitType::Fade:
             case AnimExitType::SlideFadeLeft:
             case AnimExitType::SlideFadeRight:
             case AnimExitType::SlideFadeUp:
             case AnimExitType::SlideFadeDown:
-            {
-                animation_group = new QParallelAnimationGroup(this);
-
-                animation_group->addAnimation(headline->animation.data());
-
-                QPropertyAnimation* opacity_animation = new QPropertyAnimation(headline.data(), "windowOpacity");
-                opacity_animation->setDuration(speed);
-                opacity_animation->setStartValue(1.0);
-                opacity_animation->setEndValue(0.0);
-                opacity_animation->setEasingCurve(story_info->motion_curve);
-
-                animation_group->addAnimation(opacity_animation);
+                transition->fade(headline.data(), 1.0, 0.0);
                 break;
-            }
 
             default:
                 break;
         }
 
-        exiting_map[headline] = true;
+        connect(transition, &Transition::finished, this, &Chyron::slot_headline_expired);
+        transition->set_handle(headline->get_handle());
+
+        auto& state = headline_states[headline->get_handle()];
+        state.posted = false;
+        state.exiting = true;
+        ++exiting_count;
+
         headline_list.removeAll(headline);
 
-        if(animation_group)
-            lane_manager->anim_queue(this, animation_group);
-        else
-            lane_manager->anim_queue(this, headline->animation.data());
+        lane_manager->anim_queue(this, transition);
     }
 }
 
-QAbstractAnimation* Chyron::shift_left(int amount, bool auto_start)
+Transition* Chyron::shift_left(int amount, bool auto_start)
 {
-    if(!visible || !headline_list.length())
-        return nullptr; // no headlines visible
-
-    QParallelAnimationGroup* animation_group{nullptr};
-    foreach(auto headline, headline_list)
-    {
-        auto r = headline->geometry();
-        auto animation = new QPropertyAnimation(headline.data(), "geometry");
-        animation->setDuration(story_info->anim_motion_duration);
-        animation->setStartValue(QRect(r.x(), r.y(), r.width(), r.height()));
-        animation->setEasingCurve(story_info->motion_curve);
-        animation->setEndValue(QRect(r.x() - amount, r.y(), r.width(), r.height()));
-
-        if(!animation_group)
-            animation_group = new QParallelAnimationGroup();
-        animation_group->addAnimation(animation);
-    }
-
-    if(auto_start)
-    {
-        animation_group->start(QAbstractAnimation::DeleteWhenStopped);
-        return nullptr;
-    }
-
-    return animation_group;
+    return shift_lane(QPoint(-amount, 0), auto_start);
 }
 
-QAbstractAnimation* Chyron::shift_right(int amount, bool auto_start)
+Transition* Chyron::shift_right(int amount, bool auto_start)
 {
-    if(!visible || !headline_list.length())
-        return nullptr; // no headlines visible
-
-    QParallelAnimationGroup* animation_group{nullptr};
-    foreach(auto headline, headline_list)
-    {
-        auto r = headline->geometry();
-        auto animation = new QPropertyAnimation(headline.data(), "geometry");
-        animation->setDuration(story_info->anim_motion_duration);
-        animation->setStartValue(QRect(r.x(), r.y(), r.width(), r.height()));
-        animation->setEasingCurve(story_info->motion_curve);
-        animation->setEndValue(QRect(r.x() + amount, r.y(), r.width(), r.height()));
-
-        if(!animation_group)
-            animation_group = new QParallelAnimationGroup();
-        animation_group->addAnimation(animation);
-    }
-
-    if(auto_start)
-    {
-        animation_group->start(QAbstractAnimation::DeleteWhenStopped);
-        return nullptr;
-    }
-
-    return animation_group;
+    return shift_lane(QPoint(amount, 0), auto_start);
 }
 
-QAbstractAnimation* Chyron::shift_up(int amount, bool auto_start)
+Transition* Chyron::shift_up(int amount, bool auto_start)
 {
-    if(!visible || !headline_list.length())
-        return nullptr; // no headlines visible
-
-    QParallelAnimationGroup* animation_group{nullptr};
-    foreach(auto headline, headline_list)
-    {
-        auto r = headline->geometry();
-        auto animation = new QPropertyAnimation(headline.data(), "geometry");
-        animation->setDuration(story_info->anim_motion_duration);
-        animation->setStartValue(QRect(r.x(), r.y(), r.width(), r.height()));
-        animation->setEasingCurve(story_info->motion_curve);
-        animation->setEndValue(QRect(r.x(), r.y() - amount, r.width(), r.height()));
-
-        if(!animation_group)
-            animation_group = new QParallelAnimationGroup();
-        animation_group->addAnimation(animation);
-    }
-
-    if(auto_start)
-    {
-        animation_group->start(QAbstractAnimation::DeleteWhenStopped);
-        return nullptr;
-    }
+    return shift_lane(QPoint(0, -amount), auto_start);
+}
 
-    return animation_group;
+Transition* Chyron::shift_down(int amount, bool auto_start)
+{
+    return shift_lane(QPoint(0, amount), auto_start);
 }
 
-QAbstractAnimation* Chyron::shift_down(int amount, bool auto_start)
+Transition* Chyron::shift_lane(const QPoint& offset, bool auto_start)
 {
     if(!visible || !headline_list.length())
         return nullptr; // no headlines visible
 
-    QParallelAnimationGroup* animation_group{nullptr};
+    auto transition = new Transition(story_info->anim_motion_duration, story_info->motion_curve);
     foreach(auto headline, headline_list)
     {
         auto r = headline->geometry();
-        auto animation = new QPropertyAnimation(headline.data(), "geometry");
-        animation->setDuration(story_info->anim_motion_duration);
-        animation->setStartValue(QRect(r.x(), r.y(), r.width(), r.height()));
-        animation->setEasingCurve(story_info->motion_curve);
-        animation->setEndValue(QRect(r.x(), r.y() + amount, r.width(), r.height()));
-
-        if(!animation_group)
-            animation_group = new QParallelAnimationGroup();
-        animation_group->addAnimation(animation);
+        transition->move(headline.data(), r, r.translated(offset));
     }
 
     if(auto_start)
     {
-        animation_group->start(QAbstractAnimation::DeleteWhenStopped);
+        transition->start(QAbstractAnimation::DeleteWhenStopped);
         return nullptr;
     }
 
-    return animation_group;
+    return transition;
 }
 
 void Chyron::dashboard_expire_headlines()
@@ -831,17 +644,8 @@ void Chyron::dashboard_expire_headlines()
     if(headline_list.count() == 1)
         return;     // nothing to expire
 
-    HeadlineList expired_list;
-    for(auto i = 0;i < (headline_list.count() - 1);++i)
-        expired_list.append(headline_list[i]);
-
-    foreach(auto expired, expired_list)
-    {
-        headline_list.removeAll(expired);
-        expired->hide();
-        emit signal_headline_going_out_of_scope(expired);
-        expired.clear();
-    }
+    while(headline_list.count() > 1)
+        headline_removed(headline_list.takeFirst());
 
     if(headline_list.count() == 1)
         headline_list[0]->bottom_window = nullptr;
@@ -859,15 +663,138 @@ void Chyron::slot_file_headline(HeadlinePointer headline)
     // so we have to guard against it...
 
     if(!incoming_headlines.contains(headline))
+    {
+        if(story_info->coalesce)
+        {
+            // only the latest state matters, so anything still
+            // waiting to be displayed is obsolete
+            while(!incoming_headlines.isEmpty())
+            {
+                auto stale = incoming_headlines.dequeue();
+                emit signal_headline_going_out_of_scope(stale);
+            }
+        }
+        else if(story_info->queue_limit && incoming_headlines.length() >= story_info->queue_limit)
+        {
+            if(story_info->queue_overflow == QueueOverflow::DropOldest)
+            {
+                auto stale = incoming_headlines.dequeue();
+                emit signal_headline_going_out_of_scope(stale);
+            }
+            else
+            {
+                // the Producer has been told we are full, but this
+                // one was already on its way
+                emit signal_headline_going_out_of_scope(headline);
+                return;
+            }
+        }
+
         incoming_headlines.enqueue(headline);
+        check_queue_capacity();
+
+        // get it on screen as soon as the lane allows
+        schedule_aging();
+    }
 }
 
-void Chyron::headline_posted(HeadlinePointer headline)
+void Chyron::schedule_aging()
 {
-    entering_map.remove(headline);
+    if(!visible || suspended)
+        return;     // display() and resume() will re-schedule
 
-    if(headline->animation)
-        headline->animation->deleteLater();
+    if(entering_count || exiting_count)
+        return;     // in-progress actions will re-schedule when they complete
+
+    if(incoming_headlines.length())
+    {
+        lane_manager->schedule(this, 0);
+        return;
+    }
+
+    // otherwise, sleep until the oldest Headline's time-to-display
+    // runs out ('viewed' has a resolution of seconds, and aging
+    // requires that a full 'ttl' seconds has passed)
+
+    qint64 deadline{0};
+    foreach(auto headline, headline_list)
+    {
+        if(headline->ignore)
+            continue;
+
+        auto expires = (static_cast<qint64>(headline->viewed) + story_info->ttl + 1) * 1000;
+        if(!deadline || expires < deadline)
+            deadline = expires;
+    }
+
+    if(deadline)
+        lane_manager->schedule(this, deadline);
+}
+
+void Chyron::check_queue_capacity()
+{
+    // with 'drop oldest', the newest Headline always gets in, so the
+    // Producer has to keep building them
+    if(!story_info->queue_limit || story_info->queue_overflow == QueueOverflow::DropOldest)
+        return;
+
+    auto full = incoming_headlines.length() >= story_info->queue_limit;
+    if(full != queue_full)
+    {
+        queue_full = full;
+        emit signal_queue_full(queue_full);
+    }
+}
+
+void Chyron::update_headline_rate(int posted)
+{
+    auto now = QDateTime::currentMSecsSinceEpoch();
+    if(!rate_window_start || !rate_timer.isActive())
+        rate_window_start = now;     // idle gaps don't count toward the next window
+
+    rate_window_count += posted;
+
+    if(rate_window_count && !rate_timer.isActive())
+        rate_timer.start();
+
+    auto elapsed = now - rate_window_start;
+    if(elapsed < 1000)
+        return;
+
+    // smooth each one-second sample so a single burst doesn't
+    // dominate the reported value
+    auto sample = (rate_window_count * 1000.0) / elapsed;
+    headline_rate = (headline_rate * 0.75) + (sample * 0.25);
+    if(headline_rate < 0.01)
+        headline_rate = 0.0;
+
+#ifdef QT_DEBUG
+    if(rate_window_count)
+        qDebug().nospace() << story_info->angle << ": " << headline_rate << " headlines/sec (" << incoming_headlines.count() << " queued)";
+#endif
+
+    rate_window_start = now;
+    rate_window_count = 0;
+
+    if(headline_rate == 0.0)
+        rate_timer.stop();
+}
+
+void Chyron::slot_update_headline_rate()
+{
+    update_headline_rate();
+}
+
+void Chyron::headline_posted(HeadlinePointer headline)
+{
+    auto& state = headline_states[headline->get_handle()];
+    if(state.entering)
+    {
+        state.entering = false;
+        --entering_count;
+    }
+    state.headline = headline;
+    state.posted = true;
 
     headline->viewed = QDateTime::currentDateTime().toTime_t();
 
@@ -875,65 +802,101 @@ void Chyron::headline_posted(HeadlinePointer headline)
     connect(headline.data(), &Headline::signal_mouse_exit, this, &Chyron::slot_headline_mouse_exit);
 
     headline_list.append(headline);
+    update_headline_rate(1);
 
     if(IS_DASHBOARD(story_info->entry_type))
         // give the new headline time to appear before removing old ones...
         QTimer::singleShot(50, this, [this] () { this->dashboard_expire_headlines(); });
+
+    schedule_aging();
+}
+
+void Chyron::headline_removed(HeadlinePointer headline)
+{
+    // the Headline has left the lane for good
+
+    headline_states.release(headline->get_handle());
+
+    headline->hide();
+    emit signal_headline_going_out_of_scope(headline);
 }
 
 void Chyron::slot_headline_posted()
 {
-    HeadlinePointer headline;
-    auto anim = qobject_cast<QPropertyAnimation*>(sender());
-    if(anim)
-    {
-        headline = prop_anim_map[anim];
-        prop_anim_map.remove(anim);
-    }
+    auto handle{-1};
+    auto transition = qobject_cast<Transition*>(sender());
+    if(transition)
+        handle = transition->get_handle();
     else
     {
         auto headline_ptr = qobject_cast<Headline*>(sender());
         if(!headline_ptr)
             return;
-        foreach(auto hp, headline_list)
-        {
-            if(hp.data() == headline_ptr)
-            {
-                headline = hp;
-                break;
-            }
-        }
+        handle = headline_ptr->get_handle();
     }
 
-    if(!headline.isNull())
-        headline_posted(headline);
+    auto state = headline_states.value(handle);
+    if(!state.headline.isNull() && !state.exiting)
+        headline_posted(state.headline);
 }
 
 void Chyron::slot_headline_expired()
 {
-    auto anim = qobject_cast<QPropertyAnimation*>(sender());
-    auto headline = prop_anim_map[anim];
+    auto transition = qobject_cast<Transition*>(sender());
+    if(!transition)
+        return;
 
-    prop_anim_map.remove(anim);
-    exiting_map.remove(headline);
+    auto state = headline_states.value(transition->get_handle());
+    if(state.headline.isNull() || !state.exiting)
+        return;
 
-    headline->animation->deleteLater();
+    --exiting_count;
+    headline_removed(state.headline);
 
-    headline->hide();
-    emit signal_headline_going_out_of_scope(headline);
-    headline.clear();
+    schedule_aging();
 }
 
 void Chyron::slot_age_headlines()
 {
-    if(suspended || entering_map.count() || exiting_map.count())
+    if(suspended || entering_count || exiting_count)
         return;     // let any in-progress actions complete
 
+    update_headline_rate();
+
     auto now = QDateTime::currentDateTime().toTime_t();
 
     if(incoming_headlines.length())
     {
+        if(IS_TRAIN(story_info->entry_type))
+        {
+            // trains can take a batch: all but the newest queued Headline
+            // are placed directly into the lane, and the newest animates
+            // in behind them, moving the batch along with it
+
+            auto batch{0};
+            while(incoming_headlines.length() > 1 && batch++ < MaxTrainBatch)
+            {
+                auto headline = incoming_headlines.dequeue();
+                headline->viewed = 0;
+                initialize_headline(headline);
+                post_headline_immediately(headline);
+            }
+        }
+        else if(IS_POP_OR_FADE(story_info->entry_type) || IS_DASHBOARD(story_info->entry_type))
+        {
+            // these types occupy a single position, so anything older
+            // than the newest queued Headline would just be covered up
+
+            while(incoming_headlines.length() > 1)
+            {
+                auto stale = incoming_headlines.dequeue();
+                emit signal_headline_going_out_of_scope(stale);
+            }
+        }
+
         auto headline = incoming_headlines.dequeue();
+        check_queue_capacity();
+
         headline->viewed = 0;    // let's us know when the headline was first displayed
         initialize_headline(headline);
 
@@ -954,6 +917,8 @@ void Chyron::slot_age_headlines()
             }
         }
     }
+
+    schedule_aging();
 }
 
 void Chyron::slot_train_expire_headlines()
@@ -962,29 +927,16 @@ void Chyron::slot_train_expire_headlines()
         return;
 
     // each headline that is no longer visible on the primary
-    // display will be expired
+    // display will be expired.  every headline in a train moves
+    // the same distance with each entry, so the list (oldest
+    // first) is also ordered by distance traveled, and only its
+    // front ever needs to be examined.
 
     auto desktop = QApplication::desktop();
     auto r_desktop = desktop->screenGeometry(story_info->primary_screen);
 
-    HeadlineList expired_list;
-    foreach(auto headline, headline_list)
-    {
-        auto r = headline->geometry();
-        if(!r_desktop.contains(QPoint(r.x(), r.y())) &&
-           !r_desktop.contains(QPoint(r.x(), r.y() + r.height())) &&
-           !r_desktop.contains(r.x() + r.width(), r.y() + r.height()) &&
-           !r_desktop.contains(r.x() + r.width(), r.y()))
-            expired_list.append(headline);
-    }
-
-    foreach(auto expired, expired_list)
-    {
-        headline_list.removeAll(expired);
-        expired->hide();
-        emit signal_headline_going_out_of_scope(expired);
-        expired.clear();
-    }
+    while(!headline_list.isEmpty() && has_left_screen(headline_list.front()->geometry(), r_desktop))
+        headline_removed(headline_list.takeFirst());
 
     if(story_info->train_age_effect == AgeEffects::ReduceOpacityByAge)
     {
@@ -1037,19 +989,45 @@ void Chyron::slot_train_expire_headlines()
     }
 }
 
+bool Chyron::has_left_screen(const QRect& r, const QRect& r_desktop) const
+{
+    // a train Headline has left the screen once its trailing edge
+    // passes the far side of the display in the direction of travel
+
+    switch(story_info->entry_type)
+    {
+        case AnimEntryType::TrainInLeftTop:
+        case AnimEntryType::TrainInLeftBottom:
+            return r.left() > r_desktop.right();
+        case AnimEntryType::TrainInRightTop:
+        case AnimEntryType::TrainInRightBottom:
+            return (r.x() + r.width()) < r_desktop.left();
+        case AnimEntryType::TrainDownLeftTop:
+        case AnimEntryType::TrainDownCenterTop:
+        case AnimEntryType::TrainDownRightTop:
+            return r.top() > r_desktop.bottom();
+        case AnimEntryType::TrainUpLeftBottom:
+        case AnimEntryType::TrainUpRightBottom:
+        case AnimEntryType::TrainUpCenterBottom:
+            return (r.y() + r.height()) < r_desktop.top();
+
+        default:
+            break;
+    }
+
+    return !r_desktop.intersects(r);
+}
+
 void Chyron::slot_headline_mouse_enter()
 {
     auto headline = qobject_cast<Headline*>(sender());
     if(headline->windowOpacity() < 1.0)
     {
-        opacity_map[headline] = headline->windowOpacity();
-
-        headline->animation = AnimationPointer(new QPropertyAnimation(headline, "windowOpacity"),
-                                [] (QAbstractAnimation* anim) { anim->deleteLater(); });
-        headline->animation->setDuration(150);
-        headline->animation->setStartValue(headline->windowOpacity());
-        headline->animation->setEndValue(1.0);
-        headline->animation->setEasingCurve(story_info->motion_curve);
+        headline_states[headline->get_handle()].restore_opacity = headline->windowOpacity();
+
+        headline->animation = AnimationPointer(new Transition(150, story_info->motion_curve),
+                                [] (Transition* anim) { anim->deleteLater(); });
+        headline->animation->fade(headline, headline->windowOpacity(), 1.0);
         headline->animation->start();
     }
 }
@@ -1057,16 +1035,14 @@ void Chyron::slot_headline_mouse_enter()
 void Chyron::slot_headline_mouse_exit()
 {
     auto headline = qobject_cast<Headline*>(sender());
-    if(opacity_map.contains(headline))
+    auto& state = headline_states[headline->get_handle()];
+    if(state.restore_opacity >= 0.0)
     {
-        headline->animation = AnimationPointer(new QPropertyAnimation(headline, "windowOpacity"),
-                                [] (QAbstractAnimation* anim) { anim->deleteLater(); });
-        headline->animation->setDuration(150);
-        headline->animation->setStartValue(1.0);
-        headline->animation->setEndValue(opacity_map[headline]);
-        headline->animation->setEasingCurve(story_info->motion_curve);
+        headline->animation = AnimationPointer(new Transition(150, story_info->motion_curve),
+                                [] (Transition* anim) { anim->deleteLater(); });
+        headline->animation->fade(headline, 1.0, state.restore_opacity);
         headline->animation->start();
 
-        opacity_map.remove(headline);
+        state.restore_opacity = -1.0;
     }
 }
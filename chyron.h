@@ -4,8 +4,6 @@
 
 #include <QtCore/QUrl>
 #include <QtCore/QTimer>
-#include <QtCore/QPropertyAnimation>
-#include <QtCore/QParallelAnimationGroup>
 
 #include "types.h"
 #include "specialize.h"
@@ -13,6 +11,8 @@
 
 #include "lanemanager.h"
 #include "headline.h"
+#include "transition.h"
+#include "handletable.h"
 
 /// @class Chyron
 /// @brief Manages headlines submitted by Reporters
@@ -41,15 +41,20 @@ public:
 
     StoryInfoPointer get_settings()      const   { return story_info; }
 
+    // Sustained rate (Headlines/sec) at which this Chyron is putting
+    // Headlines on the screen.  Updated once per rate window, and
+    // kept decaying by a timer while the Chyron sits idle.
+    double      get_headline_rate() const   { return headline_rate; }
+
     // These methods are used by the Dashboard to adjust lanes
     // when a Chyron is deleted.  This does an immediate move of
     // any visible Headlines in the current lane.
 
     void                unsubscribed();
-    QAbstractAnimation* shift_left(int amount, bool auto_start = true);
-    QAbstractAnimation* shift_right(int amount, bool auto_start = true);
-    QAbstractAnimation* shift_up(int amount, bool auto_start = true);
-    QAbstractAnimation* shift_down(int amount, bool auto_start = true);
+    Transition*         shift_left(int amount, bool auto_start = true);
+    Transition*         shift_right(int amount, bool auto_start = true);
+    Transition*         shift_up(int amount, bool auto_start = true);
+    Transition*         shift_down(int amount, bool auto_start = true);
 
     // This method is used by the Producer to signal to the Chyron that a
     // Reporter-drawn Headline needs to be highlighted by adjusting its opacity.
@@ -57,6 +62,7 @@ public:
 
 signals:
     void        signal_headline_going_out_of_scope(HeadlinePointer headline);
+    void        signal_queue_full(bool full);
 
 public slots:
     void        slot_file_headline(HeadlinePointer headline);
@@ -66,6 +72,7 @@ protected slots:
     void        slot_headline_posted();
     void        slot_headline_expired();
     void        slot_train_expire_headlines();
+    void        slot_update_headline_rate();
 
     void        slot_headline_mouse_enter();
     void        slot_headline_mouse_exit();
@@ -73,40 +80,59 @@ protected slots:
 protected:  // typedefs and enums
     SPECIALIZE_LIST(HeadlinePointer, Headline)          // "HeadlineList"
     SPECIALIZE_QUEUE(HeadlinePointer, Transition)       // "TransitionQueue"
-    SPECIALIZE_MAP(QPropertyAnimation*, HeadlinePointer, PropertyAnimation) // "PropertyAnimationMap"
-    SPECIALIZE_MAP(HeadlinePointer, bool, Entering)     // "EnteringMap"
-    SPECIALIZE_MAP(HeadlinePointer, bool, Exiting)      // "ExitingMap"
-    SPECIALIZE_MAP(Headline*, double, Opacity)          // "OpacityMap"
+
+    // what the Chyron knows about each Headline in its care, indexed
+    // by the Headline's handle
+    struct HeadlineState
+    {
+        HeadlinePointer headline;       // held from entry until expiry
+        bool            entering{false};
+        bool            posted{false};
+        bool            exiting{false};
+        qreal           restore_opacity{-1.0};  // opacity to return to when the mouse leaves
+    };
 
 protected:  // methods
     void        initialize_headline(HeadlinePointer headline);
     void        start_headline_entry(HeadlinePointer headline);
     void        start_headline_exit(HeadlinePointer headline);
+    Transition* shift_lane(const QPoint& offset, bool auto_start);
     void        dashboard_expire_headlines();
     void        headline_posted(HeadlinePointer headline);
+    void        headline_removed(HeadlinePointer headline);
+    void        post_headline_immediately(HeadlinePointer headline);
+    bool        calculate_entry_motion(const QRect& r, const QRect& r_desktop, QRect& target, QPoint& shift) const;
+    bool        has_left_screen(const QRect& r, const QRect& r_desktop) const;
+    void        schedule_aging();
+    void        check_queue_capacity();
+    void        update_headline_rate(int posted = 0);
 
 protected:  // data members
     StoryInfoPointer story_info;
 
-    QTimer*         age_timer{nullptr};
-
     TransitionQueue incoming_headlines;
     HeadlineList    headline_list;
     HeadlineList    reduce_list;
 
-    PropertyAnimationMap prop_anim_map;
-    EnteringMap     entering_map;
-    ExitingMap      exiting_map;
+    HandleTable<HeadlineState> headline_states;
+    int             entering_count{0};
+    int             exiting_count{0};
 
     LaneManagerPointer  lane_manager;
 
-    OpacityMap      opacity_map;
-
 #ifdef HIGHLIGHT_LANES
     HighlightWidget*    highlight{nullptr};
 #endif
 
     bool            visible{true};
     bool            suspended{false};
+    bool            queue_full{false};
+
+    qint64          rate_window_start{0};
+    int             rate_window_count{0};
+    double          headline_rate{0.0};
+    QTimer          rate_timer;
+
+    friend class LaneManager;   // wakes the Chyron via slot_age_headlines() when its deadline arrives
 };
 SPECIALIZE_SHAREDPTR(Chyron, Chyron)        // "ChyronPointer"
@@ -0,0 +1,84 @@
+#include <QtCore/QRegExp>
+#include <QtCore/QStringList>
+
+#include "compiledstyle.h"
+
+CompiledStyle::CompiledStyle(const QString& stylesheet)
+    : stylesheet(stylesheet)
+{
+    compile();
+}
+
+void CompiledStyle::compile()
+{
+    // anything with selectors or nested rules is beyond us
+    if(stylesheet.contains('{'))
+        simple = false;
+
+    foreach(const auto& declaration, stylesheet.split(';', QString::SkipEmptyParts))
+    {
+        auto colon = declaration.indexOf(':');
+        if(colon == -1)
+        {
+            if(!declaration.trimmed().isEmpty())
+                simple = false;
+            continue;
+        }
+
+        auto property = declaration.left(colon).trimmed().toLower();
+        auto value = declaration.mid(colon + 1).trimmed();
+
+        if(!property.compare("color"))
+        {
+            if(!parse_color(value, foreground))
+                simple = false;
+        }
+        else if(!property.compare("background-color") || !property.compare("background"))
+        {
+            if(!parse_color(value, background))
+                simple = false;
+        }
+        else if(!property.startsWith("border"))
+        {
+            // Headlines paint their own content, so borders never reach
+            // the screen either way.  anything else needs Qt's help.
+            simple = false;
+        }
+    }
+
+    if(foreground.isValid())
+    {
+        palette.setColor(QPalette::WindowText, foreground);
+        palette.setColor(QPalette::Text, foreground);
+    }
+
+    if(background.isValid())
+    {
+        palette.setColor(QPalette::Window, background);
+        palette.setColor(QPalette::Base, background);
+
+        progress_color = QColor(background.red(), background.green(), background.blue()).lighter(125);
+        progress_highlight = progress_color.lighter(150);
+    }
+    else
+    {
+        progress_color = palette.color(QPalette::Active, QPalette::Mid).lighter(75);
+        progress_highlight = progress_color.lighter(135);
+    }
+}
+
+bool CompiledStyle::parse_color(const QString& value, QColor& color)
+{
+    QRegExp rgb("rgb(a)?\\(\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)\\s*(,\\s*(\\d+)\\s*)?\\)", Qt::CaseInsensitive);
+    if(rgb.exactMatch(value))
+    {
+        color = QColor(rgb.cap(2).toInt(), rgb.cap(3).toInt(), rgb.cap(4).toInt());
+        if(!rgb.cap(1).isEmpty() && !rgb.cap(6).isEmpty())
+            color.setAlpha(rgb.cap(6).toInt());
+        return color.isValid();
+    }
+
+    // named colors and #rrggbb forms
+    color = QColor(value);
+    return color.isValid();
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <QtGui/QPalette>
+#include <QtGui/QColor>
+
+#include <QtCore/QString>
+
+#include "specialize.h"
+
+/// @class CompiledStyle
+/// @brief A HeadlineStyle stylesheet, interpreted once
+///
+/// Giving every Headline its own stylesheet means Qt parses the text and
+/// builds a style object for each one of them.  A CompiledStyle interprets
+/// the stylesheet of a HeadlineStyle once, and is shared by every Headline
+/// that uses that style.
+///
+/// Headline stylesheets are normally a short list of color declarations,
+/// and Headlines draw their own content, so those are reduced to a palette
+/// that can be assigned without any parsing.  Stylesheets that use anything
+/// else are flagged as not simple, and Headlines fall back to handing them
+/// to Qt.
+
+class CompiledStyle
+{
+public:
+    explicit CompiledStyle(const QString& stylesheet = QString());
+
+    const QString&  get_stylesheet()        const   { return stylesheet; }
+
+    /*!
+      Indicates that every declaration in the stylesheet is represented by
+      the palette, so Headlines can use it instead of the stylesheet.
+     */
+    bool            is_simple()             const   { return simple; }
+
+    const QPalette& get_palette()           const   { return palette; }
+
+    /*!
+      The colors used for progress bars drawn on Headlines with this style.
+      These are derived from the background color, if the stylesheet
+      declares one.
+     @{
+     */
+    const QColor&   get_progress_color()    const   { return progress_color; }
+    const QColor&   get_progress_highlight() const  { return progress_highlight; }
+    /*!
+      @}
+     */
+
+private:    // methods
+    void            compile();
+    static bool     parse_color(const QString& value, QColor& color);
+
+private:    // data members
+    QString     stylesheet;
+    bool        simple{true};
+
+    QPalette    palette;
+    QColor      foreground;
+    QColor      background;
+
+    QColor      progress_color;
+    QColor      progress_highlight;
+};
+
+SPECIALIZE_SHAREDPTR(CompiledStyle, CompiledStyle)      // "CompiledStylePointer"
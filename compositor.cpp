@@ -0,0 +1,220 @@
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QDesktopWidget>
+
+#include <QtGui/QPainter>
+#include <QtGui/QRegion>
+
+#include "headline.h"
+
+#include "compositor.h"
+
+Compositor::Compositor(int screen, bool stay_visible, QWidget *parent)
+    : QWidget(parent)
+{
+    Qt::WindowFlags flags = Qt::Tool | Qt::FramelessWindowHint;
+    if(stay_visible)
+        flags |= Qt::WindowStaysOnTopHint;
+    else
+        flags |= Qt::WindowStaysOnBottomHint;
+    setWindowFlags(flags);
+
+    setAttribute(Qt::WA_ShowWithoutActivating);
+    setAttribute(Qt::WA_TranslucentBackground, true);
+    setAttribute(Qt::WA_NoSystemBackground, true);
+    setMouseTracking(true);
+
+    auto desktop = QApplication::desktop();
+    screen_geometry = desktop->screenGeometry(screen);
+    setGeometry(screen_geometry);
+}
+
+Compositor::~Compositor()
+{
+    // Headlines that outlive us fall back to their own windows,
+    // whether or not they are currently being shown
+    foreach(auto headline, attached_list)
+    {
+        headline->compositor = nullptr;
+        headline->composited = false;
+    }
+}
+
+void Compositor::attach(Headline* headline)
+{
+    if(!attached_list.contains(headline))
+        attached_list.append(headline);
+}
+
+void Compositor::detach(Headline* headline)
+{
+    remove(headline);
+    attached_list.removeAll(headline);
+}
+
+void Compositor::add(Headline* headline)
+{
+    if(headline_list.contains(headline))
+        return;
+
+    headline_list.append(headline);
+    invalidate();
+}
+
+void Compositor::remove(Headline* headline)
+{
+    if(!headline_list.removeAll(headline))
+        return;
+
+    painted_geometry.remove(headline);
+    painted_opacity.remove(headline);
+
+    if(hover_headline == headline)
+        hover_headline = nullptr;
+
+    invalidate();
+}
+
+void Compositor::raise_headline(Headline* headline)
+{
+    if(!headline_list.removeAll(headline))
+        return;
+
+    headline_list.append(headline);
+    invalidate();
+}
+
+void Compositor::lower_headline(Headline* headline)
+{
+    if(!headline_list.removeAll(headline))
+        return;
+
+    headline_list.prepend(headline);
+    invalidate();
+}
+
+void Compositor::invalidate()
+{
+    dirty = true;
+
+    if(frame_scheduled)
+        return;
+
+    // redraw from the event loop, so a burst of changes (e.g., a
+    // Chyron shifting all of its Headlines) is drawn only once
+    frame_scheduled = true;
+    QMetaObject::invokeMethod(this, "slot_frame", Qt::QueuedConnection);
+}
+
+void Compositor::slot_frame()
+{
+    frame_scheduled = false;
+
+    // see if any of our Headlines have been moved or faded by their
+    // animations since the last time we drew them
+
+    foreach(auto headline, headline_list)
+    {
+        auto r = headline->geometry();
+        auto opacity = headline->windowOpacity();
+        if(painted_geometry.value(headline) != r || !qFuzzyCompare(painted_opacity.value(headline, -1.0), opacity))
+        {
+            painted_geometry[headline] = r;
+            painted_opacity[headline] = opacity;
+            dirty = true;
+        }
+    }
+
+    if(!dirty)
+        return;
+
+    dirty = false;
+
+    if(headline_list.isEmpty())
+    {
+        clearMask();
+        hide();
+        return;
+    }
+
+    // limit our surface to the Headlines, so the mouse can reach
+    // whatever lies beneath everywhere else
+
+    QRegion region;
+    foreach(auto headline, headline_list)
+        region += headline->geometry().translated(-screen_geometry.topLeft());
+    setMask(region);
+
+    if(!isVisible())
+        show();
+
+    update();
+}
+
+void Compositor::paintEvent(QPaintEvent* /*event*/)
+{
+    QPainter painter(this);
+
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    painter.fillRect(rect(), Qt::transparent);
+    painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+
+    foreach(auto headline, headline_list)
+    {
+        auto opacity = headline->windowOpacity();
+        if(qFuzzyIsNull(opacity))
+            continue;
+
+        auto r = headline->geometry().translated(-screen_geometry.topLeft());
+        if(!r.intersects(rect()))
+            continue;
+
+        painter.setOpacity(opacity);
+        headline->render(&painter, r.topLeft());
+    }
+}
+
+Headline* Compositor::headline_at(const QPoint& pos) const
+{
+    auto global_pos = pos + screen_geometry.topLeft();
+
+    // search from the top of the Z order
+    for(auto iter = headline_list.crbegin(); iter != headline_list.crend(); ++iter)
+    {
+        if((*iter)->geometry().contains(global_pos))
+            return *iter;
+    }
+
+    return nullptr;
+}
+
+void Compositor::set_hover(Headline* headline)
+{
+    if(headline == hover_headline)
+        return;
+
+    if(hover_headline)
+    {
+        QEvent leave(QEvent::Leave);
+        QApplication::sendEvent(hover_headline, &leave);
+    }
+
+    hover_headline = headline;
+
+    if(hover_headline)
+    {
+        QEvent enter(QEvent::Enter);
+        QApplication::sendEvent(hover_headline, &enter);
+    }
+}
+
+void Compositor::mouseMoveEvent(QMouseEvent* event)
+{
+    set_hover(headline_at(event->pos()));
+    event->accept();
+}
+
+void Compositor::leaveEvent(QEvent* event)
+{
+    set_hover(nullptr);
+    event->accept();
+}
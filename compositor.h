@@ -0,0 +1,109 @@
+#pragma once
+
+#include <QWidget>
+
+#include <QtGui/QPaintEvent>
+#include <QtGui/QMouseEvent>
+
+#include "specialize.h"
+
+class Headline;
+
+/// @class Compositor
+/// @brief A single drawing surface for all Headlines on a screen
+///
+/// Normally, every Headline is its own top-level window, and the window
+/// system must move and blend each of them for every frame of animation.
+/// When compositing is enabled, the LaneManager instead creates one
+/// transparent Compositor window per screen (and Z-order layer), and the
+/// Headlines it owns never create native windows of their own.  They keep
+/// their geometry and opacity (so all the existing entry and exit
+/// animations drive them unchanged), and the Compositor draws every one
+/// of them in a single paint pass.
+///
+/// The Compositor does not poll its Headlines.  It checks them for
+/// movement on each tick of the FrameClock, which only runs while some
+/// animation is running, and once after anything calls invalidate().
+/// When nothing is animating, it sleeps.
+///
+/// The Compositor masks itself to the union of its Headlines, so the
+/// mouse only interacts with the desktop where no Headline is shown, and
+/// it forwards enter/leave events to the Headline under the cursor.
+
+class Compositor : public QWidget
+{
+    Q_OBJECT
+public:
+    explicit Compositor(int screen, bool stay_visible, QWidget *parent = nullptr);
+    ~Compositor();
+
+    /*!
+      These methods are used by Headlines as they are assigned to, and
+      released from, this Compositor (see Headline::set_compositor()).
+      A Headline that is still assigned when the Compositor is destroyed
+      is returned to its own window.
+     @{
+     */
+    void    attach(Headline* headline);
+    void    detach(Headline* headline);
+    /*!
+      @}
+     */
+
+    /*!
+      These methods are used by Headlines to enter and leave the
+      Compositor's surface, and to adjust their position in its Z order.
+      Headlines are drawn in the order they were added, so the most
+      recently shown Headline is top-most.
+     @{
+     */
+    void    add(Headline* headline);
+    void    remove(Headline* headline);
+    void    raise_headline(Headline* headline);
+    void    lower_headline(Headline* headline);
+    /*!
+      @}
+     */
+
+    /*!
+      Forces the surface to be redrawn, for changes the Compositor cannot
+      detect on its own (e.g., Headline content, or a Headline moved or
+      faded outside of an animation).  The redraw happens once control
+      returns to the event loop, so any number of calls are coalesced.
+     */
+    void    invalidate();
+
+public slots:
+    /*!
+      Checks the Headlines for movement, and redraws the surface if any
+      have moved or if it has been invalidated.  Connected to the
+      FrameClock's signal_frame().
+     */
+    void    slot_frame();
+
+protected:  // methods
+    void    paintEvent(QPaintEvent* event) Q_DECL_OVERRIDE;
+    void    mouseMoveEvent(QMouseEvent* event) Q_DECL_OVERRIDE;
+    void    leaveEvent(QEvent* event) Q_DECL_OVERRIDE;
+
+private:    // typedefs and enums
+    SPECIALIZE_LIST(Headline*, Headline)            // "HeadlineList"
+    SPECIALIZE_MAP(Headline*, QRect, Geometry)      // "GeometryMap"
+    SPECIALIZE_MAP(Headline*, qreal, Opacity)       // "OpacityMap"
+
+private:    // methods
+    Headline*   headline_at(const QPoint& pos) const;
+    void        set_hover(Headline* headline);
+
+private:    // data members
+    QRect           screen_geometry;
+
+    HeadlineList    attached_list;      // every Headline assigned to us
+    HeadlineList    headline_list;      // in paint (Z) order, bottom first
+    GeometryMap     painted_geometry;
+    OpacityMap      painted_opacity;
+    bool            dirty{false};
+    bool            frame_scheduled{false};
+
+    Headline*       hover_headline{nullptr};
+};
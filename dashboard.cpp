@@ -1,7 +1,7 @@
 #include "chyron.h"
 #include "dashboard.h"
 
-Dashboard::Dashboard(StoryInfoPointer story_info, const QFont& headline_font, const QString& headline_stylesheet, QObject *parent)
+Dashboard::Dashboard(StoryInfoPointer story_info, const QFont& headline_font, CompiledStylePointer headline_style, Compositor* compositor, QObject *parent)
     : QObject(parent)
 {
     auto w = 0;
@@ -34,8 +34,9 @@ Dashboard::Dashboard(StoryInfoPointer story_info, const QFont& headline_font, co
                                 Qt::AlignHCenter|Qt::AlignVCenter);
     lane_header = generator.get_headline();
     lane_header->set_font(headline_font);
-    lane_header->set_stylesheet(headline_stylesheet);
+    lane_header->set_style(headline_style);
     lane_header->set_margin(0);
+    lane_header->set_compositor(compositor);
 
     if(story_info->dashboard_compact_mode)
     {
@@ -66,6 +67,7 @@ void Dashboard::add_lane(LaneDataPointer lane)
         unsubscribe_queue.removeAll(lane);
 
     chyrons.push_back(lane);
+    lane->dashboard = this;
 }
 
 bool Dashboard::is_id(const QString& id) const
@@ -73,15 +75,9 @@ bool Dashboard::is_id(const QString& id) const
     return !this->id.compare(id);
 }
 
-bool Dashboard::is_managing(Chyron* chyron) const
+bool Dashboard::is_managing(LaneDataPointer lane) const
 {
-    foreach(auto lane, chyrons)
-    {
-        if(lane->owner == chyron)
-            return true;
-    }
-
-    return false;
+    return lane && lane->dashboard == this;
 }
 
 bool Dashboard::is_empty() const
@@ -137,7 +133,9 @@ void Dashboard::remove_lane(LaneDataPointer lane, UnsubscribeAction action)
     if(action == UnsubscribeAction::Immediate)
     {
         chyrons.removeAll(lane);
+        lane->dashboard = nullptr;
         lane->owner->unsubscribed();
+        emit signal_chyron_unsubscribed(lane);
 
         if(!chyrons.length())
             emit signal_empty(lane);
@@ -180,9 +178,10 @@ void Dashboard::_remove_lane(LaneDataPointer lane)
     }
 
     // move only those Chyrons that are lower in priority
-    // than the one that is unsubscribing
+    // than the one that is unsubscribing (all of them as
+    // part of a single Transition)
 
-    QParallelAnimationGroup* animation_group{nullptr};
+    Transition* transition{nullptr};
 
     auto shifting{false};
 
@@ -197,66 +196,54 @@ void Dashboard::_remove_lane(LaneDataPointer lane)
 
         auto data_story_info = lane_data->owner->get_settings();
 
-        QAbstractAnimation* anim{nullptr};
+        Transition* anim{nullptr};
         switch(data_story_info->entry_type)
         {
             case AnimEntryType::DashboardInLeftTop:
             case AnimEntryType::DashboardInLeftBottom:
                 anim = lane_data->owner->shift_left(shift, false);
-                if(anim)
-                {
-                    if(!animation_group)
-                        animation_group = new QParallelAnimationGroup();
-                    animation_group->addAnimation(anim);
-                }
                 lane_data->lane.moveLeft(lane_data->lane.x() - shift);
                 lane_data->lane_boundaries.moveLeft(lane_data->lane_boundaries.x() - shift);
                 break;
             case AnimEntryType::DashboardInRightTop:
             case AnimEntryType::DashboardInRightBottom:
                 anim = lane_data->owner->shift_right(shift, false);
-                if(anim)
-                {
-                    if(!animation_group)
-                        animation_group = new QParallelAnimationGroup();
-                    animation_group->addAnimation(anim);
-                }
-                lane_data->lane.moveRight(lane_data->lane.x() + lane_data->lane.width() + shift);
-                lane_data->lane_boundaries.moveRight(lane_data->lane_boundaries.x() + lane_data->lane_boundaries.width() + shift);
+                lane_data->lane.moveLeft(lane_data->lane.x() + shift);
+                lane_data->lane_boundaries.moveLeft(lane_data->lane_boundaries.x() + shift);
                 break;
             case AnimEntryType::DashboardDownLeftTop:
             case AnimEntryType::DashboardDownRightTop:
                 anim = lane_data->owner->shift_up(shift, false);
-                if(anim)
-                {
-                    if(!animation_group)
-                        animation_group = new QParallelAnimationGroup();
-                    animation_group->addAnimation(anim);
-                }
-                lane_data->lane.moveBottom(lane_data->lane.y() + lane_data->lane.height() - shift);
-                lane_data->lane_boundaries.moveBottom(lane_data->lane_boundaries.y() + lane_data->lane_boundaries.height() - shift);
+                lane_data->lane.moveTop(lane_data->lane.y() - shift);
+                lane_data->lane_boundaries.moveTop(lane_data->lane_boundaries.y() - shift);
                 break;
             case AnimEntryType::DashboardUpLeftBottom:
             case AnimEntryType::DashboardUpRightBottom:
                 anim = lane_data->owner->shift_down(shift, false);
-                if(anim)
-                {
-                    if(!animation_group)
-                        animation_group = new QParallelAnimationGroup();
-                    animation_group->addAnimation(anim);
-                }
                 lane_data->lane.moveTop(lane_data->lane.y() + shift);
                 lane_data->lane_boundaries.moveTop(lane_data->lane_boundaries.y() + shift);
 
             default:
                 break;
         }
+
+        if(anim)
+        {
+            if(transition)
+            {
+                transition->merge(anim);
+                delete anim;
+            }
+            else
+                transition = anim;
+        }
     }
 
     anim_clear(lane);
-    anim_queue(lane, animation_group);
+    anim_queue(lane, transition);
 
     chyrons.removeAll(lane);
+    lane->dashboard = nullptr;
     lane->owner->unsubscribed();
     emit signal_chyron_unsubscribed(lane);
 
@@ -269,69 +256,76 @@ void Dashboard::shift(LaneDataPointer exiting)
     auto data_story_info = chyrons[0]->owner->get_settings();
     auto entry_type = data_story_info->entry_type;
 
+    // every lane, and the header, move together as one Transition
+
+    auto transition = new Transition(data_story_info->anim_motion_duration, data_story_info->motion_curve);
+
     auto shift{0};
     foreach(auto lane_data, chyrons)
     {
+        Transition* anim{nullptr};
         switch(entry_type)
         {
             case AnimEntryType::DashboardInLeftTop:
             case AnimEntryType::DashboardInRightTop:
                 shift = exiting->lane_boundaries.height();
-                lane_data->owner->shift_up(shift);
+                anim = lane_data->owner->shift_up(shift, false);
                 break;
             case AnimEntryType::DashboardInLeftBottom:
             case AnimEntryType::DashboardInRightBottom:
                 shift = exiting->lane_boundaries.height();
-                lane_data->owner->shift_down(shift);
+                anim = lane_data->owner->shift_down(shift, false);
                 break;
             case AnimEntryType::DashboardDownLeftTop:
             case AnimEntryType::DashboardUpLeftBottom:
                 shift = exiting->lane_boundaries.width();
-                lane_data->owner->shift_left(shift);
+                anim = lane_data->owner->shift_left(shift, false);
                 break;
             case AnimEntryType::DashboardDownRightTop:
             case AnimEntryType::DashboardUpRightBottom:
                 shift = exiting->lane_boundaries.width();
-                lane_data->owner->shift_right(shift);
+                anim = lane_data->owner->shift_right(shift, false);
                 break;
 
             default:
                 break;
         }
+
+        if(anim)
+        {
+            transition->merge(anim);
+            delete anim;
+        }
     }
 
     // don't forget to move the dashboard header as well
 
     auto r = get_header_geometry();
-    auto animation = new QPropertyAnimation(lane_header.data(), "geometry");
-    animation->setDuration(data_story_info->anim_motion_duration);
-    animation->setStartValue(QRect(r.x(), r.y(), r.width(), r.height()));
-    animation->setEasingCurve(data_story_info->motion_curve);
 
     switch(entry_type)
     {
         case AnimEntryType::DashboardInLeftTop:
         case AnimEntryType::DashboardInRightTop:
-            animation->setEndValue(QRect(r.x(), r.y() - shift, r.width(), r.height()));
+            transition->move(lane_header.data(), r, QRect(r.x(), r.y() - shift, r.width(), r.height()));
             break;
         case AnimEntryType::DashboardInLeftBottom:
         case AnimEntryType::DashboardInRightBottom:
-            animation->setEndValue(QRect(r.x(), r.y() + shift, r.width(), r.height()));
+            transition->move(lane_header.data(), r, QRect(r.x(), r.y() + shift, r.width(), r.height()));
             break;
         case AnimEntryType::DashboardDownLeftTop:
         case AnimEntryType::DashboardUpLeftBottom:
-            animation->setEndValue(QRect(r.x() - shift, r.y(), r.width(), r.height()));
+            transition->move(lane_header.data(), r, QRect(r.x() - shift, r.y(), r.width(), r.height()));
             break;
         case AnimEntryType::DashboardDownRightTop:
         case AnimEntryType::DashboardUpRightBottom:
-            animation->setEndValue(QRect(r.x() + shift, r.y(), r.width(), r.height()));
+            transition->move(lane_header.data(), r, QRect(r.x() + shift, r.y(), r.width(), r.height()));
             break;
 
         default:
             break;
     }
 
-    animation->start(QAbstractAnimation::DeleteWhenStopped);
+    transition->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
 void Dashboard::calculate_base_lane_position(LaneDataPointer data, const QRect& r_desktop, int r_offset_w, int r_offset_h)
@@ -434,8 +428,7 @@ void Dashboard::calculate_base_lane_position(LaneDataPointer data, const QRect&
             top = r_header_y;
             bottom = top + r_header_h;
             i = bottom + story_info->margin + (static_cast<int>(chyron_position) * (headline_h + story_info->margin));
-            lane_position.setTopLeft(QPoint(left, i));
-            lane_position.setBottomRight(QPoint(left + r_header_w, i + r_header_h));
+            lane_position = lane_rect(left, i, left + r_header_w, i + r_header_h);
             r_header_x += story_info->margin;
             r_header_y += story_info->margin;
             break;
@@ -443,24 +436,21 @@ void Dashboard::calculate_base_lane_position(LaneDataPointer data, const QRect&
             top = r_header_y;
             bottom = top + r_header_h;
             i = bottom + story_info->margin + (static_cast<int>(chyron_position) * (headline_h + story_info->margin));
-            lane_position.setTopLeft(QPoint(right - r_header_w, i));
-            lane_position.setBottomRight(QPoint(right, i + r_header_h));
+            lane_position = lane_rect(right - r_header_w, i, right, i + r_header_h);
             r_header_x -= story_info->margin;
             r_header_y += story_info->margin;
             break;
         case AnimEntryType::DashboardUpLeftBottom:
             top = r_header_y;
             i = top - story_info->margin - (static_cast<int>(chyron_position) * (headline_h + story_info->margin));
-            lane_position.setTopLeft(QPoint(left, i));
-            lane_position.setBottomRight(QPoint(left + r_header_w, i));
+            lane_position = lane_rect(left, i, left + r_header_w, i);
             r_header_x += story_info->margin;
             r_header_y -= story_info->margin;
             break;
         case AnimEntryType::DashboardUpRightBottom:
             top = r_header_y;
             i = top - story_info->margin - (static_cast<int>(chyron_position) * (headline_h + story_info->margin));
-            lane_position.setTopLeft(QPoint(right - r_header_w, i));
-            lane_position.setBottomRight(QPoint(right, i));
+            lane_position = lane_rect(right - r_header_w, i, right, i);
             r_header_x -= story_info->margin;
             r_header_y -= story_info->margin;
             break;
@@ -469,8 +459,7 @@ void Dashboard::calculate_base_lane_position(LaneDataPointer data, const QRect&
             left = r_header_x;
             right = left + r_header_w;
             i = right + story_info->margin + (static_cast<int>(chyron_position) * (headline_w + story_info->margin));
-            lane_position.setTopLeft(QPoint(i, r_header_y));
-            lane_position.setBottomRight(QPoint(i + r_header_w, r_header_y + r_header_h));
+            lane_position = lane_rect(i, r_header_y, i + r_header_w, r_header_y + r_header_h);
             r_header_x += story_info->margin;
             r_header_y += story_info->margin;
             break;
@@ -479,8 +468,7 @@ void Dashboard::calculate_base_lane_position(LaneDataPointer data, const QRect&
             left = r_header_x;
             right = left + r_header_w;
             i = right + story_info->margin + (static_cast<int>(chyron_position) * (headline_w + story_info->margin));
-            lane_position.setTopLeft(QPoint(i, r_header_y));
-            lane_position.setBottomRight(QPoint(i + r_header_w, r_header_y + r_header_h));
+            lane_position = lane_rect(i, r_header_y, i + r_header_w, r_header_y + r_header_h);
             r_header_x += story_info->margin;
             r_header_y -= story_info->margin;
             break;
@@ -488,8 +476,7 @@ void Dashboard::calculate_base_lane_position(LaneDataPointer data, const QRect&
         case AnimEntryType::DashboardInRightTop:
             left = r_header_x - r_header_w;
             i = left - story_info->margin - (static_cast<int>(chyron_position) * (headline_w + story_info->margin));
-            lane_position.setTopLeft(QPoint(i, r_header_y));
-            lane_position.setBottomRight(QPoint(i + r_header_w, r_header_y + r_header_h));
+            lane_position = lane_rect(i, r_header_y, i + r_header_w, r_header_y + r_header_h);
             r_header_x -= story_info->margin;
             r_header_y += story_info->margin;
             break;
@@ -497,8 +484,7 @@ void Dashboard::calculate_base_lane_position(LaneDataPointer data, const QRect&
         case AnimEntryType::DashboardInRightBottom:
             left = r_header_x - r_header_w;
             i = left - story_info->margin - (static_cast<int>(chyron_position) * (headline_w + story_info->margin));
-            lane_position.setTopLeft(QPoint(i, r_header_y));
-            lane_position.setBottomRight(QPoint(i + r_header_w, r_header_y + r_header_h));
+            lane_position = lane_rect(i, r_header_y, i + r_header_w, r_header_y + r_header_h);
             r_header_x -= story_info->margin;
             r_header_y -= story_info->margin;
             break;
@@ -29,11 +29,12 @@ class Dashboard: public QObject
 {
     Q_OBJECT
 public:
-    Dashboard(StoryInfoPointer story_info, const QFont& headline_font, const QString& headline_stylesheet, QObject *parent = nullptr);
+    Dashboard(StoryInfoPointer story_info, const QFont& headline_font, CompiledStylePointer headline_style, Compositor* compositor = nullptr, QObject *parent = nullptr);
     ~Dashboard();
 
-    bool    is_managing(Chyron* chyron) const;
+    bool    is_managing(LaneDataPointer lane) const;
     bool    is_empty() const;
+    int     lane_count() const      { return chyrons.count(); }
     bool    is_id(const QString& id) const;
 
     void    add_lane(LaneDataPointer lane);
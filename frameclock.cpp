@@ -0,0 +1,83 @@
+#include <QtCore/QDebug>
+
+#include "frameclock.h"
+
+// the frame intervals (msecs) the clock steps through as load increases
+const int FrameIntervals[] = { 16, 33, 50 };
+const int MaxLevel = (sizeof(FrameIntervals) / sizeof(FrameIntervals[0])) - 1;
+
+// a level must be held for this many frames before it can change again,
+// so the rate doesn't flutter between two levels
+const int SettleFrames = 30;
+
+FrameClock::FrameClock(QObject *parent)
+    : QAnimationDriver(parent)
+{
+    tick_timer = new QTimer(this);
+    tick_timer->setTimerType(Qt::PreciseTimer);
+    connect(tick_timer, &QTimer::timeout, this, &FrameClock::slot_tick);
+
+    set_level(0);
+}
+
+void FrameClock::start()
+{
+    QAnimationDriver::start();
+
+    // each burst of activity starts at the full frame rate
+    set_level(0);
+    frames_at_level = 0;
+    load = 0.0;
+
+    tick_elapsed.invalidate();
+    tick_timer->start(frame_interval);
+}
+
+void FrameClock::stop()
+{
+    tick_timer->stop();
+    QAnimationDriver::stop();
+}
+
+void FrameClock::slot_tick()
+{
+    // time the tick arrived past its due time was spent by the event
+    // loop on something else (often, repainting what we last moved)
+    qint64 late{0};
+    if(tick_elapsed.isValid())
+        late = qMax<qint64>(0, tick_elapsed.elapsed() - frame_interval);
+    tick_elapsed.start();
+
+    advance();
+    emit signal_frame();
+
+    auto sample = static_cast<double>(tick_elapsed.elapsed() + late);
+    load = (load * 0.8) + (sample * 0.2);
+
+    if(++frames_at_level < SettleFrames)
+        return;
+
+    if(level < MaxLevel && load > (frame_interval / 2.0))
+        set_level(level + 1);
+    else if(level > 0 && load < (FrameIntervals[level - 1] / 4.0))
+        set_level(level - 1);
+}
+
+void FrameClock::set_level(int new_level)
+{
+    if(frame_interval && new_level == level)
+        return;
+
+    level = new_level;
+    frame_interval = FrameIntervals[level];
+    frames_at_level = 0;
+
+    if(tick_timer->isActive())
+    {
+        tick_timer->setInterval(frame_interval);
+
+#ifdef QT_DEBUG
+        qDebug().nospace() << "FrameClock: " << frame_interval << "ms frames (" << load << "ms load)";
+#endif
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QtCore/QAnimationDriver>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
+
+/// @class FrameClock
+/// @brief Drives every running animation from one adaptive frame tick
+///
+/// Once installed, the FrameClock replaces Qt's default animation driver,
+/// so all running animations (the Chyrons' and Dashboards' Transitions,
+/// the Headlines' own zooms and fades, etc.) are advanced together in a
+/// single pass per frame.
+///
+/// The clock measures how long each frame takes to advance, and how late
+/// each tick arrives.  When the application is falling behind (lots of
+/// Headlines in motion, or a busy event loop), it lowers the frame rate
+/// in steps so the animations keep their timing without starving the
+/// rest of the application, and raises it again once the load subsides.
+/// Animations still reach their final values on time; they just take
+/// fewer intermediate steps to get there.
+
+class FrameClock : public QAnimationDriver
+{
+    Q_OBJECT
+public:
+    explicit FrameClock(QObject *parent = nullptr);
+
+    int     get_frame_interval() const  { return frame_interval; }
+
+signals:
+    // emitted after the running animations have been advanced
+    // for a frame; it is not emitted while nothing is animating
+    void    signal_frame();
+
+protected:  // methods
+    void    start() Q_DECL_OVERRIDE;
+    void    stop() Q_DECL_OVERRIDE;
+
+private slots:
+    void    slot_tick();
+
+private:    // methods
+    void    set_level(int new_level);
+
+private:    // data members
+    QTimer*         tick_timer{nullptr};
+    QElapsedTimer   tick_elapsed;
+
+    int             level{0};
+    int             frame_interval{0};
+    int             frames_at_level{0};
+    double          load{0.0};          // smoothed msecs of work per frame
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <QtCore/QVector>
+#include <QtCore/QtAlgorithms>
+
+/// @class HandleTable
+/// @brief Per-Headline state stored in flat arrays
+///
+/// Every Headline carries a small integer handle that is unique among the
+/// Headlines currently alive (pooled Headlines keep theirs while they are
+/// recycled).  Classes that need to keep state about the Headlines in their
+/// care store it in a HandleTable, indexed by that handle, instead of in
+/// maps keyed by pointers.  Lookups, insertions and removals are simple
+/// array accesses, and no nodes are allocated as Headlines come and go.
+///
+/// Handles are shared by every Headline in the process, while each table
+/// holds only the few Headlines its owner cares about.  So the table is
+/// split into pages of PageSize states, and a page is only allocated while
+/// it holds state for at least one handle.  Storage for the states grows
+/// with the number of Headlines the table holds; the only part that grows
+/// with the largest handle seen is the page index, at one pointer per
+/// PageSize handles.
+
+template <typename T>
+class HandleTable
+{
+public:
+    HandleTable() {}
+    ~HandleTable()      { qDeleteAll(pages); }
+
+    /*!
+      Returns the state for the handle, creating it (default constructed)
+      if the table does not yet hold one.  The reference remains valid
+      until the handle is released.
+
+      \param handle The Headline handle.
+     */
+    T&      operator[](int handle)
+    {
+        auto index = handle / PageSize;
+        if(index >= pages.count())
+            pages.resize(index + 1);
+
+        auto& page = pages[index];
+        if(!page)
+            page = new Page();
+
+        page->occupied |= (1u << (handle % PageSize));
+        return page->states[handle % PageSize];
+    }
+
+    /*!
+      Returns a copy of the state for the handle, or a default constructed
+      value if none has been stored.
+
+      \param handle The Headline handle.
+     */
+    T       value(int handle) const
+    {
+        auto page = find_page(handle);
+        if(!page)
+            return T();
+        return page->states[handle % PageSize];
+    }
+
+    /*!
+      Discards the state for the handle.  Its page is freed once it holds
+      no other state.
+
+      \param handle The Headline handle.
+     */
+    void    release(int handle)
+    {
+        auto page = find_page(handle);
+        if(!page)
+            return;
+
+        page->states[handle % PageSize] = T();
+        page->occupied &= ~(1u << (handle % PageSize));
+        if(!page->occupied)
+        {
+            delete page;
+            pages[handle / PageSize] = nullptr;
+        }
+    }
+
+private:    // typedefs and enums
+    static const int PageSize = 32;     // one bit of 'occupied' per state
+
+    struct Page
+    {
+        T       states[PageSize];
+        quint32 occupied{0};            // which states have been stored
+    };
+
+private:    // methods
+    Page*   find_page(int handle) const
+    {
+        if(handle < 0 || handle / PageSize >= pages.count())
+            return nullptr;
+        return pages[handle / PageSize];
+    }
+
+private:    // data members
+    QVector<Page*>  pages;
+
+    Q_DISABLE_COPY(HandleTable)
+};
@@ -9,14 +9,23 @@
 #include <QtGui/QPainter>
 #include <QtGui/QFontMetrics>
 #include <QtGui/QTextDocument>
+#include <QtGui/QTextDocumentFragment>
 #include <QtGui/QAbstractTextDocumentLayout>
 
+#include <QtCore/QDebug>
 #include <QtCore/QUrl>
 #include <QtCore/QRegExp>
-#include <QtCore/QPropertyAnimation>
+#include "compositor.h"
+#include "transition.h"
 
 #include "headline.h"
 
+uint Headline::raster_hits{0};
+uint Headline::raster_renders{0};
+
+int Headline::handle_count{0};
+QVector<int> Headline::free_handles;
+
 Headline::Headline(StoryInfoPointer story_info,
                    const QString& headline,
                    Qt::Alignment alignment,
@@ -32,10 +41,16 @@ Headline::Headline(StoryInfoPointer story_info,
         connect(hover_timer, &QTimer::timeout, this, &Headline::slot_zoom_in);
 
     set_font(story_info->font);
+    extract_progress();
 }
 
 Headline::~Headline()
 {
+    if(compositor)
+        compositor->detach(this);
+
+    free_handles.append(handle);
+
     if(hover_timer)
     {
         hover_timer->stop();
@@ -44,6 +59,15 @@ Headline::~Headline()
     }
 }
 
+int Headline::allocate_handle()
+{
+    // reuse the handles of destroyed Headlines, so HandleTables
+    // stay as small as the number of Headlines alive at once
+    if(!free_handles.isEmpty())
+        return free_handles.takeLast();
+    return handle_count++;
+}
+
 bool Headline::nativeEvent(const QByteArray &eventType, void *message, long *result)
 {
     *result = 0L;
@@ -96,6 +120,125 @@ bool Headline::nativeEvent(const QByteArray &eventType, void *message, long *res
     return false;
 }
 
+void Headline::paintEvent(QPaintEvent* /*event*/)
+{
+    auto ratio = devicePixelRatioF();
+    auto raster_size = size() * ratio;
+
+    if(raster_dirty || (reporter_draw && !reporter_draw_cached) ||
+       raster.size() != raster_size || raster_text != text())
+    {
+        raster = QPixmap(raster_size);
+        raster.setDevicePixelRatio(ratio);
+        raster.fill(Qt::transparent);
+
+        QPainter raster_painter(&raster);
+        raster_painter.setPen(palette().color(foregroundRole()));
+        raster_painter.setFont(QWidget::font());
+        paint_content(raster_painter);
+
+        raster_text = text();
+        raster_dirty = false;
+        ++raster_renders;
+    }
+    else
+        ++raster_hits;
+
+    QPainter painter(this);
+    painter.drawPixmap(0, 0, raster);
+}
+
+void Headline::changeEvent(QEvent* event)
+{
+    switch(event->type())
+    {
+        case QEvent::FontChange:
+        case QEvent::StyleChange:
+        case QEvent::PaletteChange:
+            raster_dirty = true;
+            break;
+
+        default:
+            break;
+    }
+
+    QLabel::changeEvent(event);
+}
+
+void Headline::mark_dirty()
+{
+    raster_dirty = true;
+
+    if(compositor)
+        compositor->invalidate();
+    else
+        update();
+}
+
+void Headline::notify_compositor()
+{
+    if(compositor)
+        compositor->invalidate();
+}
+
+void Headline::set_compositor(Compositor* compositor)
+{
+    if(this->compositor == compositor)
+        return;
+
+    auto was_visible = isVisible() || composited;
+    if(was_visible)
+        hide();
+
+    if(this->compositor)
+        this->compositor->detach(this);
+
+    this->compositor = compositor;
+
+    if(compositor)
+        compositor->attach(this);
+
+    if(was_visible)
+        show();
+}
+
+void Headline::setVisible(bool visible)
+{
+    if(!compositor)
+    {
+        QLabel::setVisible(visible);
+        return;
+    }
+
+    // the Compositor draws us, so we never show a window of our own.
+    // it will pick up our geometry and opacity as they are animated.
+
+    composited = visible;
+    if(visible)
+    {
+        ensurePolished();
+        compositor->add(this);
+    }
+    else
+        compositor->remove(this);
+}
+
+void Headline::raise_headline()
+{
+    if(compositor)
+        compositor->raise_headline(this);
+    else
+        raise();
+}
+
+void Headline::lower_headline()
+{
+    if(compositor)
+        compositor->lower_headline(this);
+    else
+        lower();
+}
+
 void Headline::enterEvent(QEvent *event)
 {
     mouse_in_widget = true;
@@ -132,13 +275,10 @@ void Headline::zoom_out()
 
     prepare_to_zoom_out();
 
-    auto animation = new QPropertyAnimation(this, "geometry", this);
-    animation->setDuration(200);
-    animation->setStartValue(target_geometry);
-    animation->setEndValue(starting_geometry);
-    animation->setEasingCurve(story_info->motion_curve);
-    connect(animation, &QPropertyAnimation::finished, this, &Headline::slot_turn_on_compact_mode);
-    animation->start(QAbstractAnimation::DeleteWhenStopped);
+    auto transition = new Transition(200, story_info->motion_curve, this);
+    transition->move(this, target_geometry, starting_geometry);
+    connect(transition, &Transition::finished, this, &Headline::slot_turn_on_compact_mode);
+    transition->start(QAbstractAnimation::DeleteWhenStopped);
 
     is_zoomed = false;
 }
@@ -147,12 +287,14 @@ void Headline::slot_turn_on_compact_mode()
 {
     stay_visible = was_stay_visible;
     if(!stay_visible)
-        lower();
+        lower_headline();
 
     zoomed_out();
 
     setWindowOpacity(old_opacity);
+    notify_compositor();
 
+    raster_dirty = true;
     repaint();
 }
 
@@ -223,13 +365,10 @@ void Headline::slot_zoom_in()
 //        }
 //    }
 
-    auto animation = new QPropertyAnimation(this, "geometry");
-    animation->setDuration(200);
-    animation->setStartValue(starting_geometry);
-    animation->setEndValue(target_geometry);
-    animation->setEasingCurve(story_info->motion_curve);
-    connect(animation, &QPropertyAnimation::finished, this, &Headline::slot_turn_off_compact_mode);
-    animation->start(QAbstractAnimation::DeleteWhenStopped);
+    auto transition = new Transition(200, story_info->motion_curve);
+    transition->move(this, starting_geometry, target_geometry);
+    connect(transition, &Transition::finished, this, &Headline::slot_turn_off_compact_mode);
+    transition->start(QAbstractAnimation::DeleteWhenStopped);
 
     is_zoomed = true;
 }
@@ -238,7 +377,7 @@ void Headline::slot_turn_off_compact_mode()
 {
     was_stay_visible = stay_visible;
     stay_visible = true;
-    raise();
+    raise_headline();
 
     compact_mode = false;
 
@@ -246,7 +385,9 @@ void Headline::slot_turn_off_compact_mode()
 
     old_opacity = windowOpacity();
     setWindowOpacity(1.0);
+    notify_compositor();
 
+    raster_dirty = true;
     repaint();
 }
 
@@ -255,6 +396,7 @@ void Headline::set_compact_mode(bool compact, int original_width, int original_h
     compact_mode = compact;
     original_w = original_width;
     original_h = original_height;
+    raster_dirty = true;
 }
 
 void Headline::initialize(bool stay_visible, FixedText fixed_text, int width, int height)
@@ -262,28 +404,122 @@ void Headline::initialize(bool stay_visible, FixedText fixed_text, int width, in
     this->stay_visible = stay_visible;
 
     // https://stackoverflow.com/questions/18316710/frameless-and-transparent-window-qt5
+    Qt::WindowFlags flags = Qt::Tool | Qt::FramelessWindowHint;
     if(stay_visible)
-        setWindowFlags(Qt::Tool | Qt::FramelessWindowHint | Qt::WindowStaysOnTopHint);
+        flags |= Qt::WindowStaysOnTopHint;
     else
-        setWindowFlags(Qt::Tool | Qt::FramelessWindowHint | Qt::WindowStaysOnBottomHint);
+        flags |= Qt::WindowStaysOnBottomHint;
+
+    // changing the flags re-creates the native window, which
+    // defeats the purpose of a recycled Headline
+    if(windowFlags() != flags)
+        setWindowFlags(flags);
 
 //    setParent(0); // Create TopLevel-Widget
     setAttribute(Qt::WA_ShowWithoutActivating);
 //    setAttribute(Qt::WA_TranslucentBackground, true);
 
     shrink_text_to_fit = (fixed_text == FixedText::ScaleToFit);
+    raster_dirty = true;
 
     setContentsMargins(0, 0, 0, 0);
     setTextFormat(Qt::AutoText);
     setMargin(margin);
     setFont(font);
-    setStyleSheet(stylesheet);
+
+    // simple styles are applied directly as a palette, so Qt doesn't
+    // have to parse a stylesheet and build a style for every Headline
+    if(style && !style->is_simple())
+        setStyleSheet(style->get_stylesheet());
+    else
+    {
+        if(!styleSheet().isEmpty())
+            setStyleSheet(QString());
+        setPalette(style ? style->get_palette() : QPalette());
+    }
     setText(headline);
 
     auto r = geometry();
     setGeometry(r.x(), r.y(), width, height);
 }
 
+void Headline::retire()
+{
+    hide();
+    set_compositor(nullptr);
+
+    // sever everything the previous owners attached to us (Chyron
+    // mouse tracking, Reporter drawing, etc.)
+    disconnect();
+
+    if(hover_timer)
+        hover_timer->stop();
+
+    // Transitions queued or running for the previous owner (lane shifts,
+    // Dashboard fades) may still be tracking us; they leave alone any
+    // Headline whose generation has moved on
+    ++generation;
+
+    if(animation)
+        animation->stop();
+    animation.clear();
+    setGraphicsEffect(nullptr);
+    bottom_window = nullptr;
+}
+
+void Headline::reset(StoryInfoPointer story_info, const QString& headline, Qt::Alignment alignment)
+{
+    this->story_info = story_info;
+    this->headline = headline;
+
+    stay_visible = false;
+    was_stay_visible = false;
+    mouse_in_widget = false;
+    is_zoomed = false;
+    margin = 5;
+    style.clear();
+
+    shrink_text_to_fit = false;
+    compact_mode = false;
+    reporter_draw = false;
+    reporter_draw_cached = false;
+    original_w = 0;
+    original_h = 0;
+
+    ignore = false;
+    viewed = 0;
+
+    old_opacity = 1.0;
+    setWindowOpacity(1.0);
+
+    setAlignment(alignment);
+    set_font(story_info->font);
+    extract_progress();
+}
+
+void Headline::extract_progress()
+{
+    progress_found = false;
+    progress_percent = 0.0f;
+
+    if(!story_info->include_progress_bar)
+        return;
+
+    QRegExp html_tags("<[^>]*>");
+    auto plain_text = headline;
+    if(html_tags.indexIn(headline) != -1)
+        plain_text = QTextDocumentFragment::fromHtml(headline).toPlainText();
+
+    auto& re = story_info->get_progress_expression();
+    if(re.indexIn(plain_text) != -1)
+    {
+        progress_found = true;
+        progress_percent = re.cap(1).toFloat() / 100.0f;
+        if(progress_percent > 1.0f)
+            progress_percent = 1.0f;
+    }
+}
+
 //-----------------------------------------------------------------------
 
 PortraitHeadline::PortraitHeadline(StoryInfoPointer story_info_,
@@ -300,12 +536,11 @@ PortraitHeadline::~PortraitHeadline()
 {
 }
 
-void PortraitHeadline::paintEvent(QPaintEvent* /*event*/)
+void PortraitHeadline::paint_content(QPainter& painter)
 {
     if(compact_mode)
         return;
 
-    QPainter painter(this);
     auto s = geometry();
 
     if(reporter_draw)
@@ -416,6 +651,19 @@ void PortraitHeadline::initialize(bool stay_visible_, FixedText fixed_text, int
 
 //-----------------------------------------------------------------------
 
+// shrink-to-fit searches point sizes down to MinShrinkPointSize, to
+// within ShrinkPrecision, using no more than MaxShrinkPasses layouts
+const qreal MinShrinkPointSize = 4.0;
+const qreal ShrinkPrecision = 0.1;
+const int MaxShrinkPasses = 8;
+
+// the most shrink-to-fit results remembered before the cache is flushed
+const int MaxFitCacheEntries = 512;
+
+LandscapeHeadline::FontSizeMap LandscapeHeadline::fit_cache;
+
+//-----------------------------------------------------------------------
+
 LandscapeHeadline::LandscapeHeadline(StoryInfoPointer story_info_,
                                      const QString& headline_,
                                      Qt::Alignment alignment,
@@ -427,17 +675,28 @@ LandscapeHeadline::LandscapeHeadline(StoryInfoPointer story_info_,
     progress_highlight = progress_color.lighter(135);
 
     if(story_info->include_progress_bar)
-        enable_progress_detection(story_info->progress_text_re, story_info->progress_on_top);
+        enable_progress_detection(story_info->progress_on_top);
 }
 
 LandscapeHeadline::~LandscapeHeadline()
 {
 }
 
-void LandscapeHeadline::enable_progress_detection(const QString& re, bool on_top)
+void LandscapeHeadline::reset(StoryInfoPointer story_info_, const QString& headline_, Qt::Alignment alignment)
+{
+    Headline::reset(story_info_, headline_, alignment);
+
+    detect_progress = false;
+    old_detect_progress = false;
+    layout_dirty = true;
+
+    if(story_info->include_progress_bar)
+        enable_progress_detection(story_info->progress_on_top);
+}
+
+void LandscapeHeadline::enable_progress_detection(bool on_top)
 {
     detect_progress = true;
-    progress_re = re;
     progress_on_top = on_top;
 
     progress_x = margin;
@@ -448,30 +707,14 @@ void LandscapeHeadline::enable_progress_detection(const QString& re, bool on_top
 
 void LandscapeHeadline::changeEvent(QEvent* event)
 {
-    if(event->type() == QEvent::StyleChange)
-    {
-        auto stylesheet = styleSheet();
-        QRegExp bc("background\\-color\\s*:.*rgb[a]?\\(\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)");
-        if(bc.indexIn(stylesheet) != -1)
-        {
-            auto r = bc.cap(1).toInt();
-            auto g = bc.cap(2).toInt();
-            auto b = bc.cap(3).toInt();
-            progress_color = QColor(r, g, b).lighter(125);
-            progress_highlight = progress_color.lighter(150);
-        }
-        else
-        {
-            auto p = palette();
-            progress_color = p.color(QPalette::Active, QPalette::Mid).lighter(75);
-            progress_highlight = progress_color.lighter(135);
-        }
-    }
+    if(event->type() == QEvent::FontChange || event->type() == QEvent::StyleChange)
+        layout_dirty = true;
+
+    Headline::changeEvent(event);
 }
 
-void LandscapeHeadline::paintEvent(QPaintEvent* /*event*/)
+void LandscapeHeadline::paint_content(QPainter& painter)
 {
-    QPainter painter(this);
     auto s = geometry();
 
     if(reporter_draw)
@@ -481,41 +724,10 @@ void LandscapeHeadline::paintEvent(QPaintEvent* /*event*/)
         return;
     }
 
-    QTextDocument td;
-    td.setDocumentMargin(margin);
-
-    QRegExp html_tags("<[^>]*>");
-    if(html_tags.indexIn(text()) != -1)
-        td.setHtml(text());
-    else
-        td.setPlainText(text());
+    layout_text(s.size());
 
     if(!compact_mode)
     {
-        auto doc_size = td.documentLayout()->documentSize();
-
-        if(shrink_text_to_fit)
-        {
-            auto f = td.defaultFont();
-            for(;;)
-            {
-                doc_size = td.documentLayout()->documentSize();
-                if(doc_size.width() < s.width() && doc_size.height() < s.height())
-                    break;
-
-                if((f.pointSizeF() - .1) < 4.0)
-                {
-                    // let it just clip the remaining text
-                    //f.setPointSizeF(original_point_size);
-                    //td.setDefaultFont(f);
-                    break;
-                }
-
-                f.setPointSizeF(f.pointSizeF() - .1);
-                td.setDefaultFont(f);
-            }
-        }
-
         auto y{0};
         auto x{0};
 
@@ -547,7 +759,7 @@ void LandscapeHeadline::paintEvent(QPaintEvent* /*event*/)
 
         QAbstractTextDocumentLayout::PaintContext ctx;
         ctx.palette.setColor(QPalette::Text, painter.pen().color());
-        td.documentLayout()->draw(&painter, ctx);
+        text_document->documentLayout()->draw(&painter, ctx);
 
         painter.restore();
     }
@@ -556,16 +768,12 @@ void LandscapeHeadline::paintEvent(QPaintEvent* /*event*/)
     {
         painter.save();
 
-        // see if we can detect any progress indicator in the plain
-        // text, and put a progress bar on the headline if so.
+        // if a progress indicator was detected in the plain
+        // text, put a progress bar on the headline.
 
-        auto plain_text = td.toPlainText();
-        QRegExp re(progress_re);
-        if(re.indexIn(plain_text) != -1)
+        if(progress_found)
         {
-            auto percent = re.cap(1).toFloat() / 100.0f;
-            if(percent > 1.0f)
-                percent = 1.0f;
+            auto percent = progress_percent;
 
             // draw a progress bar along the bottom
             if(compact_mode)
@@ -600,6 +808,84 @@ void LandscapeHeadline::paintEvent(QPaintEvent* /*event*/)
     }
 }
 
+void LandscapeHeadline::layout_text(const QSize& s)
+{
+    auto current_text = text();
+
+    if(!layout_dirty &&
+       text_document &&
+       laid_out_size == s &&
+       laid_out_compact == compact_mode &&
+       laid_out_text == current_text)
+        return;
+
+    // start from a fresh document, so no font reductions from a
+    // previous fit carry over
+
+    delete text_document;
+    text_document = new QTextDocument(this);
+    text_document->setDocumentMargin(margin);
+
+    QRegExp html_tags("<[^>]*>");
+    if(html_tags.indexIn(current_text) != -1)
+        text_document->setHtml(current_text);
+    else
+        text_document->setPlainText(current_text);
+
+    doc_size = text_document->documentLayout()->documentSize();
+
+    if(!compact_mode && shrink_text_to_fit)
+    {
+        auto f = text_document->defaultFont();
+
+        auto fits = [this, &s, &f] (qreal point_size) -> bool {
+            f.setPointSizeF(point_size);
+            text_document->setDefaultFont(f);
+            doc_size = text_document->documentLayout()->documentSize();
+            return doc_size.width() < s.width() && doc_size.height() < s.height();
+        };
+
+        auto key = QString("%1:%2|%3x%4|%5|%6")
+                        .arg(qHash(current_text)).arg(current_text.length())
+                        .arg(s.width()).arg(s.height())
+                        .arg(f.toString()).arg(margin);
+
+        if(fit_cache.contains(key))
+            (void)fits(fit_cache[key]);
+        else if(doc_size.width() >= s.width() || doc_size.height() >= s.height())
+        {
+            // bisect between the smallest size we allow and the starting
+            // size to find the largest point size that fits.  if even the
+            // smallest doesn't fit, it will just clip the remaining text.
+
+            auto hi = f.pointSizeF();
+            auto lo = MinShrinkPointSize;
+            if(fits(lo))
+            {
+                for(auto i = 0; i < MaxShrinkPasses && (hi - lo) > ShrinkPrecision; ++i)
+                {
+                    auto mid = (lo + hi) / 2.0;
+                    if(fits(mid))
+                        lo = mid;
+                    else
+                        hi = mid;
+                }
+
+                (void)fits(lo);
+            }
+
+            if(fit_cache.count() >= MaxFitCacheEntries)
+                fit_cache.clear();
+            fit_cache[key] = lo;
+        }
+    }
+
+    laid_out_text = current_text;
+    laid_out_size = s;
+    laid_out_compact = compact_mode;
+    layout_dirty = false;
+}
+
 QSize LandscapeHeadline::minimumSizeHint() const
 {
     auto s = QLabel::minimumSizeHint();
@@ -615,6 +901,13 @@ QSize LandscapeHeadline::sizeHint() const
 void LandscapeHeadline::initialize(bool stay_visible_, FixedText fixed_text, int width, int height)
 {
     Headline::initialize(stay_visible_, fixed_text, width, height);
+    layout_dirty = true;   // margin and shrink-to-fit may have changed
+
+    if(style)
+    {
+        progress_color = style->get_progress_color();
+        progress_highlight = style->get_progress_highlight();
+    }
 }
 
 void LandscapeHeadline::prepare_to_zoom_in()
@@ -641,14 +934,87 @@ void LandscapeHeadline::zoomed_out()
 
 //-----------------------------------------------------------------------
 
+// the most idle Headlines kept for any one size
+const int MaxSpareHeadlines = 16;
+
+HeadlinePool::PoolMap HeadlinePool::pool;
+bool HeadlinePool::closed{false};
+uint HeadlinePool::hits{0};
+uint HeadlinePool::misses{0};
+
+HeadlinePointer HeadlinePool::acquire(int w, int h,
+                                      StoryInfoPointer story_info,
+                                      const QString& headline,
+                                      Qt::Alignment alignment,
+                                      QWidget* parent)
+{
+    // Headlines that are children of another widget are owned by
+    // that widget, so they are never pooled
+    if(parent || closed)
+    {
+        if(w < h)
+            return HeadlinePointer(new PortraitHeadline(story_info, headline, alignment, true, parent));
+        return HeadlinePointer(new LandscapeHeadline(story_info, headline, alignment, parent));
+    }
+
+    auto key = DimensionsPair(w, h);
+    if(pool.contains(key) && !pool[key].isEmpty())
+    {
+        ++hits;
+
+        auto spare = pool[key].takeLast();
+        spare->reset(story_info, headline, alignment);
+        return HeadlinePointer(spare, &HeadlinePool::recycle);
+    }
+
+    ++misses;
+
+    Headline* fresh{nullptr};
+    if(w < h)
+        fresh = new PortraitHeadline(story_info, headline, alignment);
+    else
+        fresh = new LandscapeHeadline(story_info, headline, alignment);
+
+    fresh->pool_w = w;
+    fresh->pool_h = h;
+
+    return HeadlinePointer(fresh, &HeadlinePool::recycle);
+}
+
+void HeadlinePool::recycle(Headline* headline)
+{
+    auto key = DimensionsPair(headline->pool_w, headline->pool_h);
+    if(closed || (pool.contains(key) && pool[key].count() >= MaxSpareHeadlines))
+    {
+        delete headline;
+        return;
+    }
+
+    headline->retire();
+    pool[key].append(headline);
+}
+
+void HeadlinePool::clear()
+{
+#ifdef QT_DEBUG
+    qDebug() << "HeadlinePool:" << hits << "hits," << misses << "misses";
+    qDebug() << "Headline rasters:" << Headline::get_raster_hits() << "hits," << Headline::get_raster_renders() << "renders";
+#endif
+
+    closed = true;
+
+    for(auto iter = pool.begin();iter != pool.end();++iter)
+        qDeleteAll(iter.value());
+    pool.clear();
+}
+
+//-----------------------------------------------------------------------
+
 HeadlineGenerator::HeadlineGenerator(int w, int h,
                                      StoryInfoPointer story_info,
                                      const QString& headline,
                                      Qt::Alignment alignment,
                                      QWidget* parent)
 {
-    if(w < h)
-        this->headline = HeadlinePointer(new PortraitHeadline(story_info, headline, alignment, parent));
-    else
-        this->headline = HeadlinePointer(new LandscapeHeadline(story_info, headline, alignment, parent));
+    this->headline = HeadlinePool::acquire(w, h, story_info, headline, alignment, parent);
 }
@@ -4,15 +4,19 @@
 
 #include <QtGui/QPaintEvent>
 #include <QtGui/QFont>
+#include <QtGui/QPixmap>
 
 #include <QtCore/QUrl>
 #include <QtCore/QTimer>
+#include <QtCore/QVector>
 
 #include "types.h"
 #include "specialize.h"
 #include "storyinfo.h"
+#include "compiledstyle.h"
 
-class QPropertyAnimation;
+class QTextDocument;
+class Compositor;
 
 /// @class Headline
 /// @brief Contains data submitted by a Reporter
@@ -44,10 +48,73 @@ public:
     void    set_margin(int margin = 5)                  { this->margin = margin; }
 
     void    set_font(const QFont& font)                 { this->font = font; }
-    void    set_stylesheet(const QString& stylesheet)   { this->stylesheet = stylesheet; }
+    void    set_style(CompiledStylePointer style)       { this->style = style; }
 
     void    set_reporter_draw(bool reporterdraw = true) { reporter_draw = reporterdraw; }
 
+    /*!
+      A Headline drawn by its Reporter renders its content again on every
+      paint, unless the Reporter is known to emit signal_content_changed()
+      (in which case the Producer sets this, and calls mark_dirty() when
+      the content changes).
+     */
+    void    set_reporter_draw_cached(bool cached = true) { reporter_draw_cached = cached; }
+
+    /*!
+      Assigns the Compositor that will draw this Headline.  While one is
+      assigned, the Headline does not create a window of its own; showing
+      and hiding it adds and removes it from the Compositor's surface.
+      Passing nullptr returns the Headline to its own top-level window.
+
+      \param compositor The Compositor that should draw this Headline, or nullptr.
+     */
+    void    set_compositor(Compositor* compositor);
+
+    /*!
+      A Headline drawn by a Compositor has no window of its own, so moving
+      or fading it directly (rather than through an animation) goes
+      unnoticed.  Code that does so calls this to have it redrawn.
+     */
+    void    notify_compositor();
+
+    void    setVisible(bool visible) Q_DECL_OVERRIDE;
+
+    /*!
+      Headlines render their content once into a raster image, and simply
+      draw that image while their geometry or opacity is animated.  The
+      image is rendered again if the text, size, font or style changes.
+      This method is used when the content changes for any other reason
+      (e.g., a Reporter that draws its own Headlines has new data).
+     */
+    void    mark_dirty();
+
+    /*!
+      Returns a small integer that identifies this Headline among all of
+      the Headlines currently alive.  It does not change while the
+      Headline is recycled by the HeadlinePool, and it is used to index
+      per-Headline state kept in HandleTables.
+     */
+    int     get_handle() const  { return handle; }
+
+    /*!
+      Returns a count of the times this Headline has been retired by the
+      HeadlinePool.  A Transition records it with each track it holds
+      for the Headline, and drops the track if the Headline has been
+      retired (and possibly handed to another Story) since.
+     */
+    uint    get_generation() const  { return generation; }
+
+    /*!
+      The number of paints satisfied from the raster image, and the number
+      that required the content to be rendered.
+     @{
+     */
+    static uint get_raster_hits()       { return raster_hits; }
+    static uint get_raster_renders()    { return raster_renders; }
+    /*!
+      @}
+     */
+
 signals:
     void    signal_mouse_enter();
     void    signal_mouse_exit();
@@ -68,6 +135,18 @@ protected:  // methods
      */
     bool    nativeEvent(const QByteArray &eventType, void *message, long *result);
 
+    void    paintEvent(QPaintEvent*) Q_DECL_OVERRIDE;
+    void    changeEvent(QEvent* event) Q_DECL_OVERRIDE;
+
+    /*!
+      Subclasses override this to draw the content of the Headline.  The
+      painter targets the Headline's raster image, not the window, and is
+      initialized with the Headline's font and foreground color.
+
+      \param painter The QPainter to draw the content with.
+     */
+    virtual void paint_content(QPainter& /*painter*/) {}
+
     /*!
       The mouse is tracked in Headlines for various effects.  If "compact mode"
       is enabled (Dashboard), then the Headline will be "zoomed in" to full size
@@ -81,6 +160,17 @@ protected:  // methods
       @}
      */
 
+    /*!
+      Moves the Headline to the top or bottom of the Z order, whether it
+      is in its own window or drawn by a Compositor.
+     @{
+     */
+    void    raise_headline();
+    void    lower_headline();
+    /*!
+      @}
+     */
+
     /*!
       This method is employed by the Chyron and LaneManager classes to perform
       configuration of the Headline for display.  Dependending upon the value
@@ -93,12 +183,37 @@ protected:  // methods
      */
     virtual void initialize(bool stay_visible, FixedText fixed_text = FixedText::None, int width = 0, int height = 0);      // Chyron, LaneManager
 
+    /*!
+      These methods are used by the HeadlinePool to recycle a Headline.
+      retire() hides the window and severs all of its connections,
+      per-display state and Transition tracks.  reset() prepares a retired Headline to carry
+      new content, as though it had just been constructed.
+
+      \param story_info The Story the Headline will now be reporting on.
+      \param headline The text of the new Headline.
+      \param alignment The alignment of the new Headline's text.
+     @{
+     */
+    void retire();                                                                                  // HeadlinePool
+    virtual void reset(StoryInfoPointer story_info, const QString& headline, Qt::Alignment alignment);  // HeadlinePool
+    /*!
+      @}
+     */
+
     /*!
       In "compact mode", this method is called to restore the Headline to its
       compacted size after animation is complete.
      */
     void zoom_out();
 
+    /*!
+      Applies the Story's compiled progress expression to the plain text of
+      the Headline, and caches what it finds in 'progress_found' and
+      'progress_percent'.  This is done once, when the Headline is given
+      its text, so layout and painting never have to repeat it.
+     */
+    void extract_progress();
+
     /*!
       These virtual functions are for subclasses to override in case they need to
       make adjustments before and after the 'zooming' effect in Dashboard 'compact
@@ -122,11 +237,12 @@ protected:  // data members
     StoryInfoPointer    story_info;
     QString             headline;
     QFont               font;
-    QString             stylesheet;
+    CompiledStylePointer style;
 
     bool                shrink_text_to_fit{false};
     bool                compact_mode{false};
     bool                reporter_draw{false};
+    bool                reporter_draw_cached{false};
     int                 original_w{0};
     int                 original_h{0};
 
@@ -139,6 +255,8 @@ protected:  // data members
     bool                include_progress_bar{false};
     QString             progress_text_re;
     bool                progress_on_top{false};
+    bool                progress_found{false};
+    float               progress_percent{0.0f};     // 0.0 - 1.0
 
     QRect               starting_geometry, target_geometry;
     QTimer*             hover_timer{nullptr};
@@ -156,8 +274,34 @@ protected:  // data members
 
     QWidget*            bottom_window{nullptr}; // Chyron
 
+    int                 pool_w{0};      // HeadlinePool
+    int                 pool_h{0};      // HeadlinePool
+
+    Compositor*         compositor{nullptr};
+    bool                composited{false};  // currently on the Compositor's surface
+
+    QPixmap             raster;
+    QString             raster_text;
+    bool                raster_dirty{true};
+
+    int                 handle{allocate_handle()};
+    uint                generation{0};  // HeadlinePool
+
+private:    // methods
+    static int          allocate_handle();
+
+private:    // class-static data
+    static uint         raster_hits;
+    static uint         raster_renders;
+
+    static int          handle_count;
+    static QVector<int> free_handles;
+
+
     friend class Chyron;        // manages the Headline's life cycle and appearance
     friend class Dashboard;     // needs to access initialize() for its Dashboard Headline banner
+    friend class HeadlinePool;  // recycles the Headline's window
+    friend class Compositor;    // detaches the Headline if the Compositor goes away first
 };
 
 class PortraitHeadline : public Headline
@@ -186,7 +330,7 @@ public:
     void    set_for_left(bool for_left = true) { configure_for_left = for_left; }
 
 protected:      // methods
-    void    paintEvent(QPaintEvent*) Q_DECL_OVERRIDE;
+    void    paint_content(QPainter& painter) override;
     QSize   sizeHint() const Q_DECL_OVERRIDE;
     QSize   minimumSizeHint() const Q_DECL_OVERRIDE;
 
@@ -208,11 +352,12 @@ public:
 
 protected:      // methods
     void    changeEvent(QEvent* event) Q_DECL_OVERRIDE;
-    void    paintEvent(QPaintEvent*) Q_DECL_OVERRIDE;
+    void    paint_content(QPainter& painter) override;
     QSize   sizeHint() const  Q_DECL_OVERRIDE;
     QSize   minimumSizeHint() const  Q_DECL_OVERRIDE;
 
     void initialize(bool stay_visible, FixedText fixed_text = FixedText::None, int width = 0, int height = 0) override; // Chyron, LaneManager
+    void reset(StoryInfoPointer story_info, const QString& headline, Qt::Alignment alignment) override;  // HeadlinePool
 
     /*!
       We override the Headline 'zoom' hooks so we can turn off progress detection
@@ -239,15 +384,28 @@ protected:      // methods
       bottom, or if 'compact mode' is active, the entire Headline window itself will
       display the progress bar.
 
-      @param re The regular expression to use in attempts to detect progress indicator within the Headline text.
+      The Story's compiled progress expression is applied once, when the
+      Headline is given its text (see Headline::extract_progress()), and
+      painting uses the value it found.
+
       @param on_top A Boolean indicating the position of the progress bar: true places it on the top of the Headline, false on the bottom.
      */
-    void    enable_progress_detection(const QString& re, bool on_top);
+    void    enable_progress_detection(bool on_top);
+
+    /*!
+      Lays out the Headline text for the indicated size.  The laid-out
+      document is kept between paints, and is only rebuilt if the text or
+      size has changed, or if the font or style have been changed
+      since the last layout.  Animation frames simply draw the existing
+      layout.
+
+      @param s The size of the Headline the text is being laid out for.
+     */
+    void    layout_text(const QSize& s);
 
 protected:      // data members
     bool    detect_progress{false};
     bool    old_detect_progress{false};
-    QString progress_re;
 //    bool    progress_on_top;
 
     int     progress_x{0};
@@ -256,16 +414,75 @@ protected:      // data members
     int     progress_h{0};
 
     QColor  progress_color, progress_highlight;
+
+    QTextDocument*  text_document{nullptr};
+    QSizeF          doc_size;
+    QString         laid_out_text;
+    QSize           laid_out_size;
+    bool            laid_out_compact{false};
+    bool            layout_dirty{true};
+
+protected:      // typedefs and enums
+    SPECIALIZE_MAP(QString, qreal, FontSize)    // "FontSizeMap"
+
+protected:      // class-static data
+    // point sizes previously found by shrink-to-fit, keyed by the
+    // text, Headline size and font they were found for
+    static FontSizeMap  fit_cache;
 };
 
 SPECIALIZE_SHAREDPTR(Headline, Headline)    // "HeadlinePointer"
 
+/// @class HeadlinePool
+/// @brief Recycles Headline windows instead of destroying them
+///
+/// Every report used to cost the creation and destruction of a native
+/// top-level window.  Headlines handed out by the HeadlinePool carry a
+/// shared-pointer deleter that returns them here when the last reference
+/// is dropped, and they are reset and reused for the next Headline of the
+/// same orientation and size.
+
+class HeadlinePool
+{
+public:
+    static HeadlinePointer  acquire(int w, int h,
+                                    StoryInfoPointer story_info,
+                                    const QString& headline,
+                                    Qt::Alignment alignment = Qt::AlignLeft | Qt::AlignVCenter,
+                                    QWidget* parent = nullptr);
+
+    /*!
+      Destroys all spare Headlines.  Any Headline released after this
+      call is destroyed rather than pooled, so this should be called
+      as the application shuts down.
+     */
+    static void             clear();
+
+    static uint             get_hits()      { return hits; }
+    static uint             get_misses()    { return misses; }
+
+private:    // typedefs and enums
+    SPECIALIZE_LIST(Headline*, Spare)                   // "SpareList"
+    SPECIALIZE_PAIR(int, int, Dimensions)               // "DimensionsPair"
+    SPECIALIZE_MAP(DimensionsPair, SpareList, Pool)     // "PoolMap"
+
+private:    // methods
+    static void             recycle(Headline* headline);
+
+private:    // class-static data
+    static PoolMap          pool;
+    static bool             closed;
+    static uint             hits;
+    static uint             misses;
+};
+
 /// @class HeadlineGenerator
 /// @brief Helper class for generating the correct Headline subclass
 ///
 /// HeadlineGenerator is a simple helper class that generates the
-/// correct Headline subclass for the dimensions provided.  It is
-/// intended to be used on the stack.
+/// correct Headline subclass for the dimensions provided, reusing a
+/// pooled Headline where possible.  It is intended to be used on the
+/// stack.
 
 class HeadlineGenerator
 {
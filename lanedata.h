@@ -6,6 +6,7 @@
 #include "specialize.h"
 
 class Chyron;
+class Dashboard;
 
 /// @class LaneData
 /// @brief Contains lane-specific data for the LaneManager
@@ -16,8 +17,26 @@ class Chyron;
 struct LaneData
 {
     Chyron*     owner{nullptr};
+    Dashboard*  dashboard{nullptr};     // The Dashboard managing this lane, if any
     QRect       lane;               // This is a static value that marks the lane position
     QRect       lane_boundaries;    // This is passed to the Chyron for modification, and is based on 'lane'
+    int         departing_shift{0}; // Space given up by a departed lane (owner is nullptr) awaiting LaneManager::commit()
 };
 SPECIALIZE_SHAREDPTR(LaneData, LaneData)        // "LaneDataPointer"
+
+/*!
+  Builds a lane position from the coordinates of its edges.  Lane positions
+  use exclusive right and bottom edges throughout (read them back with
+  x() + width() and y() + height(), never right() or bottom()), so a lane
+  that is only an edge of the screen has no width or no height.
+
+  \param left The left edge.
+  \param top The top edge.
+  \param right The (exclusive) right edge.
+  \param bottom The (exclusive) bottom edge.
+ */
+inline QRect lane_rect(int left, int top, int right, int bottom)
+{
+    return QRect(left, top, right - left, bottom - top);
+}
 SPECIALIZE_LIST(LaneDataPointer, Lane)          // "LaneList"
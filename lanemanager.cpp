@@ -1,16 +1,30 @@
+#include <QtCore/QDateTime>
+
 #include "chyron.h"
 
 #include "lanemanager.h"
 
+// future deadlines are rounded up to this granularity (msecs) so
+// Chyrons with nearby deadlines are serviced by the same wake-up
+const qint64 DeadlineResolution = 50;
+
 LaneManager::LaneManager(const QFont& font, const QString& stylesheet, QObject *parent)
     : QObject(parent),
       headline_font(font),
-      headline_stylesheet(stylesheet)
+      headline_style(new CompiledStyle(stylesheet))
 {
+    deadline_timer = new QTimer(this);
+    deadline_timer->setSingleShot(true);
+    connect(deadline_timer, &QTimer::timeout, this, &LaneManager::slot_process_deadlines);
+
+    frame_clock = new FrameClock(this);
+    frame_clock->install();
 }
 
 LaneManager::~LaneManager()
 {
+    foreach(auto compositor, compositor_map)
+        delete compositor;
 }
 
 void LaneManager::subscribe(Chyron* chyron)
@@ -45,7 +59,8 @@ void LaneManager::subscribe(Chyron* chyron)
 
         if(dashboard_group.isNull())
         {
-            dashboard_group = DashboardPointer(new Dashboard(story_info, headline_font, headline_stylesheet));
+            dashboard_group = DashboardPointer(new Dashboard(story_info, headline_font, headline_style,
+                                                             get_compositor(story_info->primary_screen, story_info->headlines_always_visible)));
             connect(dashboard_group.data(), &Dashboard::signal_chyron_unsubscribed, this, &LaneManager::slot_dashboard_chyron_unsubscribed);
             connect(dashboard_group.data(), &Dashboard::signal_empty, this, &LaneManager::slot_dashboard_empty);
             connect(dashboard_group.data(), &Dashboard::signal_animation_started, this, &LaneManager::slot_animation_started);
@@ -83,14 +98,7 @@ void LaneManager::unsubscribe(Chyron* chyron, UnsubscribeAction action)
 
     if(IS_DASHBOARD(story_info->entry_type))
     {
-        auto iter = dashboard_map[story_info->entry_type].begin();
-        for(;iter != dashboard_map[story_info->entry_type].end();++iter)
-        {
-            if((*iter)->is_managing(chyron))
-                break;
-        }
-
-        if(iter == dashboard_map[story_info->entry_type].end())
+        if(!data->dashboard)
         {
             // hmm... really shouldn't happen
             data_map.remove(chyron);
@@ -102,14 +110,12 @@ void LaneManager::unsubscribe(Chyron* chyron, UnsubscribeAction action)
         // if ExitAction is 'Graceful', the Dashboard will emit
         // "signal_unsubscribe_chyron" when any necessary animations
         // are complete
-        (*iter)->remove_lane(data, action);
+        data->dashboard->remove_lane(data, action);
 
         return;
     }
 
-    auto lane_list = &lane_map[story_info->entry_type];
-
-    // calculate the shift amount
+    // calculate the space this lane gives up
     switch(story_info->entry_type)
     {
         case AnimEntryType::SlideDownLeftTop:
@@ -149,74 +155,136 @@ void LaneManager::unsubscribe(Chyron* chyron, UnsubscribeAction action)
             break;
     }
 
-    // move only those Chyrons that are lower in priority
-    // than the one that is unsubscribing
-    auto shifting{false};
+    // the lane keeps its place in the list (without an owner) until
+    // the transaction is committed, so lanes below it are only moved
+    // once, no matter how many above them depart
 
-    foreach(auto lane_data, (*lane_list))
-    {
-        if(lane_data->owner == chyron)
-            shifting = true;
-        if(!shifting || lane_data->owner == chyron)
-            continue;
+    begin();
 
-        auto data_story_info = lane_data->owner->get_settings();
+    data->departing_shift = shift;
+    data->owner = nullptr;
+    data_map.remove(chyron);
 
-        switch(data_story_info->entry_type)
+    if(!collapsing.contains(story_info->entry_type))
+        collapsing.append(story_info->entry_type);
+
+    chyron->unsubscribed();
+
+    commit();
+}
+
+void LaneManager::begin()
+{
+    ++transaction_depth;
+}
+
+void LaneManager::commit()
+{
+    if(!transaction_depth || --transaction_depth)
+        return;
+
+    // move only those Chyrons that are lower in priority than
+    // departed lanes, each by the total space departed above it
+    // (all of them as part of a single Transition)
+
+    Transition* transition{nullptr};
+
+    foreach(auto entry_type, collapsing)
+    {
+        LaneList remaining;
+        auto shift{0};
+
+        foreach(auto lane_data, lane_map[entry_type])
         {
-            case AnimEntryType::SlideDownLeftTop:
-            case AnimEntryType::TrainDownLeftTop:
-            case AnimEntryType::SlideUpLeftBottom:
-            case AnimEntryType::TrainUpLeftBottom:
-            case AnimEntryType::SlideDownCenterTop:
-            case AnimEntryType::TrainDownCenterTop:
-            case AnimEntryType::SlideUpCenterBottom:
-            case AnimEntryType::TrainUpCenterBottom:
-            case AnimEntryType::DashboardInLeftTop:
-            case AnimEntryType::DashboardInLeftBottom:
-                lane_data->owner->shift_left(shift);
-                lane_data->lane.moveLeft(lane_data->lane.x() - shift);
-                lane_data->lane_boundaries.moveLeft(lane_data->lane_boundaries.x() - shift);
-                break;
-            case AnimEntryType::SlideDownRightTop:
-            case AnimEntryType::TrainDownRightTop:
-            case AnimEntryType::SlideUpRightBottom:
-            case AnimEntryType::TrainUpRightBottom:
-            case AnimEntryType::DashboardInRightTop:
-            case AnimEntryType::DashboardInRightBottom:
-                lane_data->owner->shift_right(shift);
-                lane_data->lane.moveRight(lane_data->lane.x() + lane_data->lane.width() + shift);
-                lane_data->lane_boundaries.moveRight(lane_data->lane_boundaries.x() + lane_data->lane_boundaries.width() + shift);
-                break;
-            case AnimEntryType::SlideInLeftTop:
-            case AnimEntryType::TrainInLeftTop:
-            case AnimEntryType::SlideInRightTop:
-            case AnimEntryType::TrainInRightTop:
-            case AnimEntryType::DashboardDownLeftTop:
-            case AnimEntryType::DashboardDownRightTop:
-                lane_data->owner->shift_up(shift);
-                lane_data->lane.moveBottom(lane_data->lane.y() + lane_data->lane.height() - shift);
-                lane_data->lane_boundaries.moveBottom(lane_data->lane_boundaries.y() + lane_data->lane_boundaries.height() - shift);
-                break;
-            case AnimEntryType::SlideInLeftBottom:
-            case AnimEntryType::TrainInLeftBottom:
-            case AnimEntryType::SlideInRightBottom:
-            case AnimEntryType::TrainInRightBottom:
-            case AnimEntryType::DashboardUpLeftBottom:
-            case AnimEntryType::DashboardUpRightBottom:
-                lane_data->owner->shift_down(shift);
-                lane_data->lane.moveTop(lane_data->lane.y() + shift);
-                lane_data->lane_boundaries.moveTop(lane_data->lane_boundaries.y() + shift);
-
-            default:
-                break;
+            if(!lane_data->owner)
+            {
+                shift += lane_data->departing_shift;
+                continue;
+            }
+
+            remaining.push_back(lane_data);
+            if(!shift)
+                continue;
+
+            auto anim = shift_lane(lane_data, shift);
+            if(anim)
+            {
+                if(transition)
+                {
+                    transition->merge(anim);
+                    delete anim;
+                }
+                else
+                    transition = anim;
+            }
         }
+
+        lane_map[entry_type] = remaining;
     }
 
-    data_map.remove(chyron);
-    lane_map[story_info->entry_type].removeAll(data);
+    collapsing.clear();
 
-    chyron->unsubscribed();
+    if(transition)
+        track_animation(transition);
+}
+
+Transition* LaneManager::shift_lane(LaneDataPointer lane_data, int shift)
+{
+    auto story_info = lane_data->owner->get_settings();
+
+    Transition* anim{nullptr};
+    switch(story_info->entry_type)
+    {
+        case AnimEntryType::SlideDownLeftTop:
+        case AnimEntryType::TrainDownLeftTop:
+        case AnimEntryType::SlideUpLeftBottom:
+        case AnimEntryType::TrainUpLeftBottom:
+        case AnimEntryType::SlideDownCenterTop:
+        case AnimEntryType::TrainDownCenterTop:
+        case AnimEntryType::SlideUpCenterBottom:
+        case AnimEntryType::TrainUpCenterBottom:
+        case AnimEntryType::DashboardInLeftTop:
+        case AnimEntryType::DashboardInLeftBottom:
+            anim = lane_data->owner->shift_left(shift, false);
+            lane_data->lane.moveLeft(lane_data->lane.x() - shift);
+            lane_data->lane_boundaries.moveLeft(lane_data->lane_boundaries.x() - shift);
+            break;
+        case AnimEntryType::SlideDownRightTop:
+        case AnimEntryType::TrainDownRightTop:
+        case AnimEntryType::SlideUpRightBottom:
+        case AnimEntryType::TrainUpRightBottom:
+        case AnimEntryType::DashboardInRightTop:
+        case AnimEntryType::DashboardInRightBottom:
+            anim = lane_data->owner->shift_right(shift, false);
+            lane_data->lane.moveLeft(lane_data->lane.x() + shift);
+            lane_data->lane_boundaries.moveLeft(lane_data->lane_boundaries.x() + shift);
+            break;
+        case AnimEntryType::SlideInLeftTop:
+        case AnimEntryType::TrainInLeftTop:
+        case AnimEntryType::SlideInRightTop:
+        case AnimEntryType::TrainInRightTop:
+        case AnimEntryType::DashboardDownLeftTop:
+        case AnimEntryType::DashboardDownRightTop:
+            anim = lane_data->owner->shift_up(shift, false);
+            lane_data->lane.moveTop(lane_data->lane.y() - shift);
+            lane_data->lane_boundaries.moveTop(lane_data->lane_boundaries.y() - shift);
+            break;
+        case AnimEntryType::SlideInLeftBottom:
+        case AnimEntryType::TrainInLeftBottom:
+        case AnimEntryType::SlideInRightBottom:
+        case AnimEntryType::TrainInRightBottom:
+        case AnimEntryType::DashboardUpLeftBottom:
+        case AnimEntryType::DashboardUpRightBottom:
+            anim = lane_data->owner->shift_down(shift, false);
+            lane_data->lane.moveTop(lane_data->lane.y() + shift);
+            lane_data->lane_boundaries.moveTop(lane_data->lane_boundaries.y() + shift);
+            break;
+
+        default:
+            break;
+    }
+
+    return anim;
 }
 
 const QRect& LaneManager::get_base_lane_position(Chyron* chyron)
@@ -248,7 +316,7 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
 
         foreach(auto dashboard, dashboard_map[story_info->entry_type])
         {
-            if(dashboard->is_id(story_info->dashboard_group_id) && dashboard->is_managing(data->owner))
+            if(dashboard->is_id(story_info->dashboard_group_id) && dashboard->is_managing(data))
             {
                 dashboard->calculate_base_lane_position(data, r_desktop, r_offset_w, r_offset_h);
                 break;
@@ -282,36 +350,31 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
         case AnimEntryType::TrainDownLeftTop:
         case AnimEntryType::SlideUpLeftBottom:
         case AnimEntryType::TrainUpLeftBottom:
-            lane_position.setTopLeft(QPoint(left, top));
-            lane_position.setBottomRight(QPoint(left, bottom));
+            lane_position = lane_rect(left, top, left, bottom);
             break;
         case AnimEntryType::SlideDownCenterTop:
         case AnimEntryType::TrainDownCenterTop:
         case AnimEntryType::SlideUpCenterBottom:
         case AnimEntryType::TrainUpCenterBottom:
-            lane_position.setTopLeft(QPoint(width / 2, top));
-            lane_position.setBottomRight(QPoint(width / 2, bottom));
+            lane_position = lane_rect(width / 2, top, width / 2, bottom);
             break;
         case AnimEntryType::SlideDownRightTop:
         case AnimEntryType::TrainDownRightTop:
         case AnimEntryType::SlideUpRightBottom:
         case AnimEntryType::TrainUpRightBottom:
-            lane_position.setTopLeft(QPoint(right, top));
-            lane_position.setBottomRight(QPoint(right, bottom));
+            lane_position = lane_rect(right, top, right, bottom);
             break;
         case AnimEntryType::SlideInLeftTop:
         case AnimEntryType::TrainInLeftTop:
         case AnimEntryType::SlideInRightTop:
         case AnimEntryType::TrainInRightTop:
-            lane_position.setTopLeft(QPoint(left, top));
-            lane_position.setBottomRight(QPoint(right, top));
+            lane_position = lane_rect(left, top, right, top);
             break;
         case AnimEntryType::SlideInLeftBottom:
         case AnimEntryType::TrainInLeftBottom:
         case AnimEntryType::SlideInRightBottom:
         case AnimEntryType::TrainInRightBottom:
-            lane_position.setTopLeft(QPoint(left, bottom));
-            lane_position.setBottomRight(QPoint(right, bottom));
+            lane_position = lane_rect(left, bottom, right, bottom);
             break;
 
         // boundaries defined for these depend upon their corresponding exit type
@@ -323,20 +386,17 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
                 case AnimExitType::SlideRight:
                 case AnimExitType::SlideFadeLeft:
                 case AnimExitType::SlideFadeRight:
-                    lane_position.setTopLeft(QPoint(left, top + (height / 2)));
-                    lane_position.setBottomRight(QPoint(right, top + (height / 2)));
+                    lane_position = lane_rect(left, top + (height / 2), right, top + (height / 2));
                     break;
                 case AnimExitType::SlideUp:
                 case AnimExitType::SlideDown:
                 case AnimExitType::SlideFadeUp:
                 case AnimExitType::SlideFadeDown:
-                    lane_position.setTopLeft(QPoint(left + (width / 2), top));
-                    lane_position.setBottomRight(QPoint(left + (width / 2), bottom));
+                    lane_position = lane_rect(left + (width / 2), top, left + (width / 2), bottom);
                     break;
                 case AnimExitType::Fade:
                 case AnimExitType::Pop:
-                    lane_position.setTopLeft(QPoint(left + (width / 2), top + (height / 2)));
-                    lane_position.setBottomRight(QPoint(left + (width / 2), top + (height / 2)));
+                    lane_position = lane_rect(left + (width / 2), top + (height / 2), left + (width / 2), top + (height / 2));
                     break;
             }
             break;
@@ -348,20 +408,17 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
                 case AnimExitType::SlideRight:
                 case AnimExitType::SlideFadeLeft:
                 case AnimExitType::SlideFadeRight:
-                    lane_position.setTopLeft(QPoint(left, top));
-                    lane_position.setBottomRight(QPoint(right, top));
+                    lane_position = lane_rect(left, top, right, top);
                     break;
                 case AnimExitType::SlideUp:
                 case AnimExitType::SlideDown:
                 case AnimExitType::SlideFadeUp:
                 case AnimExitType::SlideFadeDown:
-                    lane_position.setTopLeft(QPoint(left, top));
-                    lane_position.setBottomRight(QPoint(left, bottom));
+                    lane_position = lane_rect(left, top, left, bottom);
                     break;
                 case AnimExitType::Fade:
                 case AnimExitType::Pop:
-                    lane_position.setTopLeft(QPoint(left, top));
-                    lane_position.setBottomRight(QPoint(left, top));
+                    lane_position = lane_rect(left, top, left, top);
                     break;
             }
             break;
@@ -373,20 +430,17 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
                 case AnimExitType::SlideRight:
                 case AnimExitType::SlideFadeLeft:
                 case AnimExitType::SlideFadeRight:
-                    lane_position.setTopLeft(QPoint(left, top));
-                    lane_position.setBottomRight(QPoint(right, top));
+                    lane_position = lane_rect(left, top, right, top);
                     break;
                 case AnimExitType::SlideUp:
                 case AnimExitType::SlideDown:
                 case AnimExitType::SlideFadeUp:
                 case AnimExitType::SlideFadeDown:
-                    lane_position.setTopLeft(QPoint(right, top));
-                    lane_position.setBottomRight(QPoint(right, bottom));
+                    lane_position = lane_rect(right, top, right, bottom);
                     break;
                 case AnimExitType::Fade:
                 case AnimExitType::Pop:
-                    lane_position.setTopLeft(QPoint(right, top));
-                    lane_position.setBottomRight(QPoint(right, top));
+                    lane_position = lane_rect(right, top, right, top);
                     break;
             }
             break;
@@ -398,20 +452,17 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
                 case AnimExitType::SlideRight:
                 case AnimExitType::SlideFadeLeft:
                 case AnimExitType::SlideFadeRight:
-                    lane_position.setTopLeft(QPoint(left, bottom));
-                    lane_position.setBottomRight(QPoint(right, bottom));
+                    lane_position = lane_rect(left, bottom, right, bottom);
                     break;
                 case AnimExitType::SlideUp:
                 case AnimExitType::SlideDown:
                 case AnimExitType::SlideFadeUp:
                 case AnimExitType::SlideFadeDown:
-                    lane_position.setTopLeft(QPoint(left, top));
-                    lane_position.setBottomRight(QPoint(left, bottom));
+                    lane_position = lane_rect(left, top, left, bottom);
                     break;
                 case AnimExitType::Fade:
                 case AnimExitType::Pop:
-                    lane_position.setTopLeft(QPoint(left, bottom));
-                    lane_position.setBottomRight(QPoint(left, bottom));
+                    lane_position = lane_rect(left, bottom, left, bottom);
                     break;
             }
             break;
@@ -423,20 +474,17 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
                 case AnimExitType::SlideRight:
                 case AnimExitType::SlideFadeLeft:
                 case AnimExitType::SlideFadeRight:
-                    lane_position.setTopLeft(QPoint(left, bottom));
-                    lane_position.setBottomRight(QPoint(right, bottom));
+                    lane_position = lane_rect(left, bottom, right, bottom);
                     break;
                 case AnimExitType::SlideUp:
                 case AnimExitType::SlideDown:
                 case AnimExitType::SlideFadeUp:
                 case AnimExitType::SlideFadeDown:
-                    lane_position.setTopLeft(QPoint(right, top));
-                    lane_position.setBottomRight(QPoint(right, bottom));
+                    lane_position = lane_rect(right, top, right, bottom);
                     break;
                 case AnimExitType::Fade:
                 case AnimExitType::Pop:
-                    lane_position.setTopLeft(QPoint(right, bottom));
-                    lane_position.setBottomRight(QPoint(right, bottom));
+                    lane_position = lane_rect(right, bottom, right, bottom);
                     break;
             }
             break;
@@ -471,7 +519,8 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
         return;
 
     // 'iter' is pointing at the next highest priority lane data; shift
-    // lane position based upon it
+    // lane position based upon it, so its edge sits exactly on the
+    // edge of that lane's boundaries
 
     r_higher = (*iter)->lane_boundaries;
 
@@ -482,8 +531,8 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
         case AnimEntryType::SlideUpLeftBottom:
         case AnimEntryType::TrainUpLeftBottom:
             // shift right
-            lane_position.setRight(r_higher.left() + r_higher.width());
-            lane_position.setLeft(lane_position.right());
+            lane_position.moveLeft(r_higher.x() + r_higher.width());
+            lane_position.setWidth(0);
             break;
         case AnimEntryType::SlideDownCenterTop:
         case AnimEntryType::TrainDownCenterTop:
@@ -491,43 +540,43 @@ void LaneManager::calculate_base_lane_position(LaneDataPointer data)
         case AnimEntryType::TrainUpCenterBottom:
             // for center, we should ping-pong positions
             // for now, we just shift right
-            lane_position.setRight(r_higher.left() + r_higher.width());
-            lane_position.setLeft(lane_position.right());
+            lane_position.moveLeft(r_higher.x() + r_higher.width());
+            lane_position.setWidth(0);
             break;
         case AnimEntryType::SlideDownRightTop:
         case AnimEntryType::TrainDownRightTop:
         case AnimEntryType::SlideUpRightBottom:
         case AnimEntryType::TrainUpRightBottom:
             // shift left
-            lane_position.setLeft(r_higher.right() - r_higher.width());
-            lane_position.setRight(lane_position.left());
+            lane_position.moveLeft(r_higher.x());
+            lane_position.setWidth(0);
             break;
 
         case AnimEntryType::SlideInLeftTop:
         case AnimEntryType::SlideInLeftBottom:
             // shift right
-            lane_position.setRight(r_higher.left() + r_higher.width());
-            lane_position.setLeft(lane_position.right());
+            lane_position.moveLeft(r_higher.x() + r_higher.width());
+            lane_position.setWidth(0);
             break;
         case AnimEntryType::SlideInRightTop:
         case AnimEntryType::SlideInRightBottom:
             // shift left
-            lane_position.setLeft(r_higher.right() - r_higher.width());
-            lane_position.setRight(lane_position.left());
+            lane_position.moveLeft(r_higher.x());
+            lane_position.setWidth(0);
             break;
 
         case AnimEntryType::TrainInLeftTop:
         case AnimEntryType::TrainInRightTop:
             // shift down
-            lane_position.setTop(r_higher.top() + r_higher.height());
-            lane_position.setBottom(lane_position.top());
+            lane_position.moveTop(r_higher.y() + r_higher.height());
+            lane_position.setHeight(0);
             break;
 
         case AnimEntryType::TrainInLeftBottom:
         case AnimEntryType::TrainInRightBottom:
             // shift up
-            lane_position.setTop(r_higher.bottom() - r_higher.height());
-            lane_position.setBottom(lane_position.top());
+            lane_position.moveTop(r_higher.y());
+            lane_position.setHeight(0);
             break;
 
         // boundaries defined for these depend upon their corresponding exit type
@@ -640,17 +689,11 @@ void LaneManager::anim_queue(Chyron* chyron, QAbstractAnimation* anim)
 
     if(IS_DASHBOARD(story_info->entry_type))
     {
-        auto iter = dashboard_map[story_info->entry_type].begin();
-        for(;iter != dashboard_map[story_info->entry_type].end();++iter)
-        {
-            if((*iter)->is_managing(chyron))
-                break;
-        }
-
-        if(iter == dashboard_map[story_info->entry_type].end())
+        auto data = data_map.value(chyron);
+        if(!data || !data->dashboard)
             return;         // shouldn't happen...
 
-        (*iter)->anim_queue(data_map[chyron], anim);
+        data->dashboard->anim_queue(data, anim);
     }
     else
         anim->start(QAbstractAnimation::DeleteWhenStopped);
@@ -662,17 +705,17 @@ void LaneManager::anim_clear(Chyron *chyron)
     if(!IS_DASHBOARD(story_info->entry_type))
         return;
 
-    auto iter = dashboard_map[story_info->entry_type].begin();
-    for(;iter != dashboard_map[story_info->entry_type].end();++iter)
-    {
-        if((*iter)->is_managing(chyron))
-            break;
-    }
-
-    if(iter == dashboard_map[story_info->entry_type].end())
+    auto data = data_map.value(chyron);
+    if(!data || !data->dashboard)
         return;         // shouldn't happen...
 
-    (*iter)->anim_clear(data_map[chyron]);
+    data->dashboard->anim_clear(data);
+}
+
+Dashboard* LaneManager::dashboard_for(Chyron* chyron) const
+{
+    auto data = data_map.value(chyron);
+    return data ? data->dashboard : nullptr;
 }
 
 bool LaneManager::anim_in_progress() const
@@ -733,5 +776,113 @@ void LaneManager::slot_animation_started()
 
 void LaneManager::slot_animation_completed()
 {
-    --animation_count;
+    if(--animation_count == 0)
+        emit signal_animations_complete();
+}
+
+void LaneManager::track_animation(QAbstractAnimation* anim)
+{
+    // lane shifts are counted like the Dashboards' animations, so
+    // anim_in_progress() covers every change to the lane layout
+
+    connect(anim, &QAbstractAnimation::finished, this, &LaneManager::slot_animation_completed);
+    ++animation_count;
+    anim->start(QAbstractAnimation::DeleteWhenStopped);
+}
+
+void LaneManager::schedule(Chyron* chyron, qint64 deadline)
+{
+    auto now = QDateTime::currentMSecsSinceEpoch();
+    if(deadline > now)
+        deadline = ((deadline + DeadlineResolution - 1) / DeadlineResolution) * DeadlineResolution;
+    else
+        deadline = now;
+
+    if(deadline_map.contains(chyron))
+    {
+        auto current = deadline_map[chyron];
+        if(current <= deadline)
+            return;     // it will already be woken in time
+
+        schedule_map[current].removeAll(chyron);
+        if(schedule_map[current].isEmpty())
+            schedule_map.remove(current);
+    }
+
+    deadline_map[chyron] = deadline;
+    schedule_map[deadline].append(chyron);
+
+    arm_deadline_timer();
+}
+
+void LaneManager::unschedule(Chyron* chyron)
+{
+    if(!deadline_map.contains(chyron))
+        return;
+
+    auto current = deadline_map[chyron];
+    deadline_map.remove(chyron);
+
+    schedule_map[current].removeAll(chyron);
+    if(schedule_map[current].isEmpty())
+        schedule_map.remove(current);
+
+    arm_deadline_timer();
+}
+
+void LaneManager::arm_deadline_timer()
+{
+    if(schedule_map.isEmpty())
+    {
+        deadline_timer->stop();
+        return;
+    }
+
+    auto delay = schedule_map.firstKey() - QDateTime::currentMSecsSinceEpoch();
+    deadline_timer->start(static_cast<int>(qMax(delay, static_cast<qint64>(0))));
+}
+
+void LaneManager::slot_process_deadlines()
+{
+    auto now = QDateTime::currentMSecsSinceEpoch();
+
+    // collect everything that is due before waking anybody, because
+    // a Chyron will usually register its next deadline while it runs
+
+    ChyronList due;
+    while(!schedule_map.isEmpty() && schedule_map.firstKey() <= now)
+    {
+        foreach(auto chyron, schedule_map.first())
+        {
+            deadline_map.remove(chyron);
+            due.append(chyron);
+        }
+        schedule_map.erase(schedule_map.begin());
+    }
+
+    foreach(auto chyron, due)
+        chyron->slot_age_headlines();
+
+    arm_deadline_timer();
+}
+
+void LaneManager::set_compositing(bool composite)
+{
+    compositing = composite;
+}
+
+Compositor* LaneManager::get_compositor(int screen, bool stay_visible)
+{
+    if(!compositing)
+        return nullptr;
+
+    auto key = SurfacePair(screen, stay_visible);
+    if(!compositor_map.contains(key))
+    {
+        auto compositor = new Compositor(screen, stay_visible);
+        connect(frame_clock, &FrameClock::signal_frame, compositor, &Compositor::slot_frame);
+        compositor_map[key] = compositor;
+    }
+
+    return compositor_map[key];
 }
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <QtCore/QTimer>
+
 #include "types.h"
 #include "specialize.h"
 
 #include "dashboard.h"
 #include "headline.h"
+#include "compositor.h"
+#include "frameclock.h"
 
 /// @class LaneManager
 /// @brief Manages lane positions for Chyrons
@@ -12,6 +16,9 @@
 /// The LaneManager is responsible for positioning Chyrons on the screen.
 /// It will account for Chyrons of the same 'entry type', and stack lanes
 /// intelligently.
+///
+/// The LaneManager also installs the FrameClock that advances every
+/// Chyron's and Dashboard's animations together, once per frame.
 
 class LaneManager : public QObject
 {
@@ -24,6 +31,17 @@ public:
     void    unsubscribe(Chyron* chyron, UnsubscribeAction action = UnsubscribeAction::Immediate);
     void    shelve(Chyron* chyron);
 
+    /*!
+      Groups any number of subscribe(), unsubscribe() and shelve() calls
+      into a single layout pass.  Lanes that depart inside a transaction
+      hold their place until the outermost commit(), which then moves each
+      remaining lane once, by the total space freed above it, as part of
+      a single Transition.  Calls may be nested; unsubscribing outside of
+      a transaction behaves as a transaction of one.
+     */
+    void    begin();
+    void    commit();
+
     void    anim_queue(Chyron *chyron, QAbstractAnimation* anim);
     void    anim_clear(Chyron* chyron);
     bool    anim_in_progress() const;
@@ -31,11 +49,57 @@ public:
     const QRect&  get_base_lane_position(Chyron* chyron);
     QRect&  get_lane_boundaries(Chyron* chyron);
 
+    // the Dashboard managing the Chyron's lane, or nullptr if it has none
+    Dashboard*  dashboard_for(Chyron* chyron) const;
+    // the number of Chyrons currently subscribed
+    int     lane_count() const      { return data_map.count(); }
+
+    /*!
+      Chyrons no longer run their own aging timers.  Instead, each one
+      registers the next time (msecs since epoch) it has real work to do,
+      and the LaneManager wakes it from a single shared timer that sleeps
+      until the earliest registered deadline.  A Chyron holds at most one
+      deadline; scheduling a later one than it already holds is ignored.
+
+      \param chyron The Chyron to wake.
+      \param deadline The time, in milliseconds since the epoch, when it should be woken.  Values in the past wake it as soon as possible.
+     */
+    void    schedule(Chyron* chyron, qint64 deadline);
+    void    unschedule(Chyron* chyron);
+
+    /*!
+      Enables or disables drawing Headlines through a shared Compositor
+      surface instead of giving each one its own window.  The change
+      applies to Headlines that are initialized after the call.
+
+      \param composite A Boolean indicating whether Compositors should be used.
+     */
+    void    set_compositing(bool composite);
+
+    /*!
+      Retrieves the Compositor that draws Headlines on the indicated screen
+      and Z-order layer, creating it if needed.  Returns nullptr if
+      compositing is not enabled.
+
+      \param screen The screen the Headline will be displayed on.
+      \param stay_visible Whether the Headline should be top-most in the Z order.
+     */
+    Compositor* get_compositor(int screen, bool stay_visible);
+
+signals:
+    /*!
+      Emitted when the last animation that rearranges lanes (Dashboard
+      animations, and the shifts that close the gap left by a departing
+      Chyron) has completed.  anim_in_progress() is false at that point.
+     */
+    void    signal_animations_complete();
+
 private slots:
     void    slot_dashboard_chyron_unsubscribed(LaneDataPointer lane);
     void    slot_dashboard_empty(LaneDataPointer lane);
     void    slot_animation_started();
     void    slot_animation_completed();
+    void    slot_process_deadlines();
 
 private:    // typedefs and enums
     SPECIALIZE_LIST(DashboardPointer, Dashboard)    // "DashboardList"
@@ -44,18 +108,41 @@ private:    // typedefs and enums
     SPECIALIZE_MAP(AnimEntryType, LaneList, Lane)   // "LaneMap"
     SPECIALIZE_MAP(Chyron*, LaneDataPointer, Data)  // "DataMap"
 
+    SPECIALIZE_LIST(Chyron*, Chyron)                // "ChyronList"
+    SPECIALIZE_MAP(qint64, ChyronList, Schedule)    // "ScheduleMap"
+    SPECIALIZE_MAP(Chyron*, qint64, Deadline)       // "DeadlineMap"
+
+    SPECIALIZE_LIST(AnimEntryType, EntryType)       // "EntryTypeList"
+
+    SPECIALIZE_PAIR(int, bool, Surface)             // "SurfacePair"
+    SPECIALIZE_MAP(SurfacePair, Compositor*, Compositor)   // "CompositorMap"
+
 private:    // methods
     void            calculate_base_lane_position(LaneDataPointer data);
+    void            arm_deadline_timer();
+    void            track_animation(QAbstractAnimation* anim);
+    Transition*     shift_lane(LaneDataPointer lane_data, int shift);
 
 private:    // datamembers
     LaneMap         lane_map;
     DataMap         data_map;
     DashboardMap    dashboard_map;
 
+    int             transaction_depth{0};
+    EntryTypeList   collapsing;         // entry types with departed lanes awaiting commit()
+
     QFont           headline_font;
-    QString         headline_stylesheet;
+    CompiledStylePointer headline_style;
 
     int             animation_count{0};
+    FrameClock*     frame_clock{nullptr};
+
+    QTimer*         deadline_timer{nullptr};
+    ScheduleMap     schedule_map;       // ordered by deadline
+    DeadlineMap     deadline_map;
+
+    bool            compositing{false};
+    CompositorMap   compositor_map;
 };
 
 SPECIALIZE_SHAREDPTR(LaneManager, LaneManager)      // "LaneManagerPointer"
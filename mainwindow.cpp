@@ -47,6 +47,7 @@ MainWindow::MainWindow(QWidget *parent)
     background_image = PixmapPointer(new QPixmap(":/images/Newsroom256.png"));
 
     headline_style_list = StyleListPointer(new HeadlineStyleList());
+    trigger_matcher = TriggerMatcherPointer(new TriggerMatcher());
 
     application_settings_folder_name = QDir::toNativeSeparators(QString("%1/Newsroom%2")
                                     .arg(QStandardPaths::standardLocations(QStandardPaths::GenericConfigLocation)[0])
@@ -121,6 +122,10 @@ MainWindow::MainWindow(QWidget *parent)
 
 MainWindow::~MainWindow()
 {
+    // any Headlines still alive after this point are destroyed
+    // rather than returned to the pool
+    HeadlinePool::clear();
+
     delete ui;
 }
 
@@ -401,10 +406,13 @@ bool MainWindow::cover_story(ProducerPointer& producer,
 
         // assign a staff Producer to receive Reporter filings and create Headlines
 
-        producer = ProducerPointer(new Producer(chyron, reporter, story_info, headline_style_list, this));
+        producer = ProducerPointer(new Producer(chyron, reporter, story_info, trigger_matcher, this));
 
         connect(producer.data(), &Producer::signal_shelve_story, this, &MainWindow::slot_shelve_story);
         connect(producer.data(), &Producer::signal_unshelve_story, this, &MainWindow::slot_unshelve_story);
+
+        producer_index[producer.data()] = producer;
+        connect(producer.data(), &QObject::destroyed, this, [this] (QObject* obj) { producer_index.remove(static_cast<Producer*>(obj)); });
     }
 
     if(coverage_start == CoverageStart::Delayed)
@@ -660,6 +668,7 @@ void MainWindow::save_application_settings()
     application_settings->set_item("auto_start", auto_start);
     application_settings->set_item("continue_coverage", continue_coverage);
     application_settings->set_item("autostart_coverage", autostart_coverage);
+    application_settings->set_item("use_compositor", use_compositor);
     application_settings->set_item("chyron.font", headline_font.toString());
 
     application_settings->clear_section("HeadlineStyles");
@@ -729,6 +738,7 @@ void MainWindow::load_application_settings()
     auto_start = application_settings->get_item("auto_start", false).toBool();
     continue_coverage = application_settings->get_item("continue_coverage", false).toBool();
     autostart_coverage = application_settings->get_item("autostart_coverage", true).toBool();
+    use_compositor = application_settings->get_item("use_compositor", false).toBool();
     auto f = ui->label->font();
     auto font_str = application_settings->get_item("chyron.font", f.toString()).toString();
     if(!font_str.isEmpty())
@@ -763,7 +773,11 @@ void MainWindow::load_application_settings()
     }
     application_settings->end_array();
 
+    trigger_matcher->compile(*(headline_style_list.data()));
+
     lane_manager = LaneManagerPointer(new LaneManager(headline_font, (*headline_style_list.data())[0].stylesheet, this));
+    connect(lane_manager.data(), &LaneManager::signal_animations_complete, this, &MainWindow::slot_process_shelving_queue);
+    lane_manager->set_compositing(use_compositor);
 
     auto windata_size = application_settings->begin_array("WindowData");
     if(windata_size)
@@ -851,11 +865,13 @@ void MainWindow::load_series(SeriesInfoPointer series_info)
         }
 
         // launch the Stories in user-defined order
+        lane_manager->begin();
         foreach(auto key, start_info.keys())
         {
             if(start_info[key] != CoverageStart::None)
                 cover_story(key, key->get_story(), start_info[key]);
         }
+        lane_manager->commit();
     }
 
     series_settings->end_array();
@@ -923,6 +939,9 @@ void MainWindow::restore_story_defaults(StoryInfoPointer story_info)
     story_info->reporter_parameters_version = application_settings->get_item("reporter_parameters_version", 1).toInt();
     // Note: Reporter parameter defaults are managed by the AddStoryDialog class
     story_info->ttl                      = static_cast<unsigned int>(application_settings->get_item("ttl", story_info->ttl).toInt());
+    story_info->queue_limit              = application_settings->get_item("queue_limit", 0).toInt();
+    story_info->queue_overflow           = static_cast<QueueOverflow>(application_settings->get_item("queue_overflow", 0).toInt());
+    story_info->coalesce                 = application_settings->get_item("coalesce", false).toBool();
     story_info->primary_screen           = application_settings->get_item("primary_screen", 0).toInt();
     story_info->headlines_always_visible = application_settings->get_item("headlines_always_visible", true).toBool();
     story_info->interpret_as_pixels      = application_settings->get_item("interpret_as_pixels", true).toBool();
@@ -966,6 +985,9 @@ void MainWindow::save_story_defaults(StoryInfoPointer story_info)
     application_settings->set_item("reporter_parameters_version", story_info->reporter_parameters_version);
     // Note: Reporter parameter defaults are managed by the AddStoryDialog class
     application_settings->set_item("ttl", story_info->ttl);
+    application_settings->set_item("queue_limit", story_info->queue_limit);
+    application_settings->set_item("queue_overflow", static_cast<int>(story_info->queue_overflow));
+    application_settings->set_item("coalesce", story_info->coalesce);
     application_settings->set_item("primary_screen", story_info->primary_screen);
     application_settings->set_item("headlines_always_visible", story_info->headlines_always_visible);
     application_settings->set_item("interpret_as_pixels", story_info->interpret_as_pixels);
@@ -1008,6 +1030,9 @@ void MainWindow::save_story(SettingsPointer settings, StoryInfoPointer story_inf
     settings->set_item("reporter_class", story_info->reporter_beat);
     settings->set_item("reporter_id", story_info->reporter_id);
     settings->set_item("ttl", story_info->ttl);
+    settings->set_item("queue_limit", story_info->queue_limit);
+    settings->set_item("queue_overflow", static_cast<int>(story_info->queue_overflow));
+    settings->set_item("coalesce", story_info->coalesce);
     settings->set_item("primary_screen", story_info->primary_screen);
     settings->set_item("headlines_always_visible", story_info->headlines_always_visible);
     settings->set_item("interpret_as_pixels", story_info->interpret_as_pixels);
@@ -1086,6 +1111,9 @@ void MainWindow::restore_story(SettingsPointer settings, StoryInfoPointer story_
     story_info->reporter_beat            = settings->get_item("reporter_class", QString()).toString();
     story_info->reporter_id              = settings->get_item("reporter_id", QString()).toString();
     story_info->ttl                      = static_cast<unsigned int>(settings->get_item("ttl", story_info->ttl).toInt());
+    story_info->queue_limit              = settings->get_item("queue_limit", 0).toInt();
+    story_info->queue_overflow           = static_cast<QueueOverflow>(settings->get_item("queue_overflow", 0).toInt());
+    story_info->coalesce                 = settings->get_item("coalesce", false).toBool();
     story_info->primary_screen           = settings->get_item("primary_screen", 0).toInt();
     story_info->headlines_always_visible = settings->get_item("headlines_always_visible", true).toBool();
     story_info->interpret_as_pixels      = settings->get_item("interpret_as_pixels", true).toBool();
@@ -1207,9 +1235,11 @@ void MainWindow::slot_edit_settings(bool /*checked*/)
     settings_dlg->set_autostart(auto_start);
     settings_dlg->set_continue_coverage(continue_coverage);
     settings_dlg->set_autostart_coverage(autostart_coverage);
+    settings_dlg->set_compositing(use_compositor);
     settings_dlg->set_font(headline_font);
     settings_dlg->set_styles(*(headline_style_list.data()));
     settings_dlg->set_series(series_ordered);
+    settings_dlg->set_lane_manager(lane_manager);
 
     restore_window_data(settings_dlg);
 
@@ -1224,8 +1254,11 @@ void MainWindow::slot_edit_settings(bool /*checked*/)
         auto_start         = settings_dlg->get_autostart();
         continue_coverage  = settings_dlg->get_continue_coverage();
         autostart_coverage = settings_dlg->get_autostart_coverage();
+        use_compositor     = settings_dlg->get_compositing();
+        lane_manager->set_compositing(use_compositor);
         headline_font      = settings_dlg->get_font();
         settings_dlg->get_styles(*(headline_style_list.data()));
+        trigger_matcher->compile(*(headline_style_list.data()));
 
         // get a list of the Story ids that will deleted by the call
         // to get_series() below.  this gives us a means to clear any
@@ -1347,96 +1380,97 @@ void MainWindow::slot_edit_story(const QString& story_id)
 
 void MainWindow::slot_shelve_story()
 {
-    auto producer_raw = qobject_cast<Producer*>(sender());
+    queue_shelving(qobject_cast<Producer*>(sender()), true);
+}
+
+void MainWindow::slot_unshelve_story()
+{
+    queue_shelving(qobject_cast<Producer*>(sender()), false);
+}
 
+void MainWindow::queue_shelving(Producer* producer_raw, bool shelve)
+{
     // find this Producer shared pointer so we don't cling to the raw pointer
 
-    ProducerPointer producer;
-    foreach(auto si, series_ordered)
-    {
-        foreach(auto pp, si->producers)
-        {
-            if(pp.data() == producer_raw)
-            {
-                producer = pp;
-                break;
-            }
-        }
+    auto producer = producer_index.value(producer_raw).toStrongRef();
+    if(producer.isNull())
+        return;
 
-        if(!producer.isNull())
-            break;
-    }
+    // only the latest request for a Producer matters
+    if(!shelving_requests.contains(producer_raw))
+        shelving_queue.enqueue(producer);
+    shelving_requests[producer_raw] = shelve;
 
-    if(!shelve_queue.contains(producer))
-        shelve_queue.enqueue(producer);
-    if(shelve_queue.length() == 1)
-        QTimer::singleShot(100, this, &MainWindow::slot_process_shelve_queue);
+    // let every request raised in this pass of the event loop
+    // arrive before any of them are applied
+    if(!shelving_scheduled)
+    {
+        shelving_scheduled = true;
+        QTimer::singleShot(0, this, &MainWindow::slot_process_shelving_queue);
+    }
 }
 
-void MainWindow::slot_unshelve_story()
+void MainWindow::slot_process_shelving_queue()
 {
-    auto producer_raw = qobject_cast<Producer*>(sender());
+    shelving_scheduled = false;
 
-    // find this Producer shared pointer so we don't cling to the raw pointer
+    if(shelving_queue.isEmpty())
+        return;
 
-    ProducerPointer producer;
-    foreach(auto si, series_ordered)
+    // lanes that are still moving will call us back (via
+    // LaneManager::signal_animations_complete) when they settle
+    if(lane_manager->anim_in_progress())
+        return;
+
+    // apply as many requests as can share one layout pass.  the
+    // LaneManager collapses any number of shelved lanes of an entry type
+    // in one transaction, but Dashboards animate each departure on their
+    // own, so only one of those can be shelved per entry type.  unshelved
+    // stories just append lanes, so any number of those can share an
+    // entry type that is not also collapsing.  anything else waits for
+    // the next pass.
+
+    QMap<AnimEntryType, bool> collapsing;     // entry type -> a story was shelved
+    ProducerQueue deferred;
+
+    lane_manager->begin();
+    while(!shelving_queue.isEmpty())
     {
-        foreach(auto pp, si->producers)
+        auto producer = shelving_queue.dequeue();
+        auto shelve = shelving_requests.value(producer.data());
+
+        auto entry_type = producer->get_story()->entry_type;
+        auto exclusive = IS_DASHBOARD(entry_type) && shelve;
+        if(collapsing.contains(entry_type) && (exclusive || collapsing[entry_type] != shelve))
         {
-            if(pp.data() == producer_raw)
-            {
-                producer = pp;
-                break;
-            }
+            deferred.enqueue(producer);
+            continue;
         }
 
-        if(!producer.isNull())
-            break;
-    }
-
-    if(!unshelve_queue.contains(producer))
-        unshelve_queue.enqueue(producer);
-    if(unshelve_queue.length() == 1)
-        QTimer::singleShot(100, this, &MainWindow::slot_process_unshelve_queue);
-}
-
-void MainWindow::slot_process_shelve_queue()
-{
-    if(!shelve_queue.length())
-        return;     // shouldn't happen, but just in case...
+        shelving_requests.remove(producer.data());
 
-    if(!lane_manager->anim_in_progress())
-    {
-        auto producer = shelve_queue.head();
-        if(!producer.isNull())
+        if(shelve)
         {
             if(producer->is_covering_story() && !producer->is_story_shelved())
+            {
                 producer->shelve_story();
+                collapsing[entry_type] = true;
+            }
+        }
+        else if(producer->is_story_shelved())
+        {
+            producer->start_covering_story();
+            if(!collapsing.contains(entry_type))
+                collapsing[entry_type] = false;
         }
-        (void)shelve_queue.dequeue();
     }
+    lane_manager->commit();
 
-    if(shelve_queue.length())
-        QTimer::singleShot(100, this, &MainWindow::slot_process_shelve_queue);
-}
-
-void MainWindow::slot_process_unshelve_queue()
-{
-    if(!unshelve_queue.length())
-        return;     // shouldn't happen, but just in case...
+    shelving_queue = deferred;
 
-    if(!lane_manager->anim_in_progress())
+    if(!shelving_queue.isEmpty() && !lane_manager->anim_in_progress())
     {
-        auto producer = unshelve_queue.head();
-        if(!producer.isNull())
-        {
-            if(producer->is_story_shelved())
-                producer->start_covering_story();
-        }
-        (void)unshelve_queue.dequeue();
+        shelving_scheduled = true;
+        QTimer::singleShot(0, this, &MainWindow::slot_process_shelving_queue);
     }
-
-    if(unshelve_queue.length())
-        QTimer::singleShot(100, this, &MainWindow::slot_process_unshelve_queue);
 }
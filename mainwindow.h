@@ -19,6 +19,7 @@
 #include <QtCore/QUrl>
 #include <QtCore/QMap>
 #include <QtCore/QVector>
+#include <QtCore/QHash>
 #include <QtCore/QByteArray>
 #include <QtCore/QMimeDatabase>
 #include <QtCore/QPluginLoader>
@@ -27,6 +28,7 @@
 #include "seriesinfo.h"
 #include "lanemanager.h"
 #include "settings.h"
+#include "triggermatcher.h"
 
 #include "addstorydialog.h"
 #include "settingsdialog.h"
@@ -93,8 +95,7 @@ private slots:
     void                slot_edit_story(const QString& story_id);
     void                slot_shelve_story();
     void                slot_unshelve_story();
-    void                slot_process_shelve_queue();
-    void                slot_process_unshelve_queue();
+    void                slot_process_shelving_queue();
 
 private:    // methods
     bool                configure_reporters();
@@ -108,6 +109,7 @@ private:    // methods
     void                save_story_defaults(StoryInfoPointer story_info);
     bool                cover_story(ProducerPointer& producer, StoryInfoPointer story_info, CoverageStart coverage_start, const ReportersInfoVector *reporters_info = nullptr);
     void                fix_angle_duplication(StoryInfoPointer story_info);
+    void                queue_shelving(Producer* producer_raw, bool shelve);
 
     const ReporterInfo* get_reporter_info(const QString& id) const;
 
@@ -119,6 +121,7 @@ private:    // data members
     bool                auto_start{false};
     bool                continue_coverage{false};
     bool                autostart_coverage{true};
+    bool                use_compositor{false};
     bool                edit_story_first_time{true};
 
     QSystemTrayIcon*    trayIcon;
@@ -150,6 +153,7 @@ private:    // data members
     QString             application_settings_file_name;
 
     StyleListPointer    headline_style_list;
+    TriggerMatcherPointer trigger_matcher;  // compiled from headline_style_list, shared by Producers
 
     int                 last_start_offset{0};
 
@@ -162,6 +166,12 @@ private:    // data members
     QString             parameters_defaults_folder;
     QString             parameters_stories_folder;
 
-    ProducerQueue       shelve_queue;
-    ProducerQueue       unshelve_queue;
+    // Producers are found by their raw pointer when they signal
+    QHash<Producer*, ProducerWeakPointer> producer_index;
+
+    // pending shelve (true) and unshelve (false) requests, in the order
+    // they arrived; a Producer appears at most once, with its latest request
+    ProducerQueue       shelving_queue;
+    QHash<Producer*, bool> shelving_requests;
+    bool                shelving_scheduled{false};
 };
@@ -1,22 +1,28 @@
 #include <QtCore/QDebug>
 #include <QtCore/QDateTime>
 
+#include "reportsplitter.h"
+
 #include "producer.h"
 
 Producer::Producer(ChyronPointer chyron,
                    IReporterPointer reporter,
                    StoryInfoPointer story_info,
-                   StyleListPointer style_list,
+                   TriggerMatcherPointer trigger_matcher,
                    QObject *parent)
     : QObject(parent),
       reporter(reporter),
       chyron(chyron),
       story_info(story_info),
-      style_list(style_list)
+      trigger_matcher(trigger_matcher)
 {
     auto reporter_draw = dynamic_cast<IReporter2*>(reporter.data());
     if(reporter_draw && reporter_draw->UseReporterDraw())
+    {
         connect(chyron.data(), &Chyron::signal_headline_going_out_of_scope, this, &Producer::slot_headline_going_out_of_scope);
+        connect(reporter_draw, &IReporter2::signal_content_changed, this, &Producer::slot_reporter_content_changed);
+    }
+    connect(chyron.data(), &Chyron::signal_queue_full, this, &Producer::slot_chyron_queue_full);
 }
 
 Producer::~Producer()
@@ -95,30 +101,17 @@ bool Producer::shelve_story()
 
 void Producer::file_headline(const QString& data)
 {
-    // check for keyword triggers, and select the stylesheet appropriately
-
-    auto lower_headline = data.toLower();
-
-    QString stylesheet, default_stylesheet;
-    foreach(const auto& style, (*style_list.data()))
+    if(chyron_queue_full)
     {
-        if(!style.name.compare("Default"))
-            default_stylesheet = style.stylesheet;
-        else if(stylesheet.isEmpty())
-        {
-            foreach(const auto& trigger, style.triggers)
-            {
-                if(lower_headline.contains(trigger.toLower()))
-                {
-                    stylesheet = style.stylesheet;
-                    break;
-                }
-            }
-        }
+        // the Chyron can't accept any more right now, so don't
+        // build a Headline (and its window) just to throw it away
+        ++suppressed_count;
+        return;
     }
 
-    if(stylesheet.isEmpty())
-        stylesheet = default_stylesheet;    // set to Default
+    // check for keyword triggers, and select the style appropriately
+
+    auto style = trigger_matcher->match(data);
 
     // file a headline with the new content
     auto w{0};
@@ -127,18 +120,22 @@ void Producer::file_headline(const QString& data)
     HeadlineGenerator generator(w, h, story_info, data);
     auto headline = generator.get_headline();
 
-    headline->set_stylesheet(stylesheet);
+    headline->set_style(style);
 
     auto reporter_draw = dynamic_cast<IReporter2*>(reporter.data());
     if(reporter_draw && reporter_draw->UseReporterDraw())
     {
         headline->set_reporter_draw(true);
+        headline->set_reporter_draw_cached(content_signaled);
         connect(headline.data(), &Headline::signal_reporter_draw, reporter_draw, &IReporter2::ReporterDraw);
-        connect(reporter_draw, &IReporter2::signal_highlight, this, &Producer::slot_headline_highlight);
+        connect(reporter_draw, &IReporter2::signal_highlight, this, &Producer::slot_headline_highlight, Qt::UniqueConnection);
         headlines.append(headline);
+        tracked[headline->get_handle()] = true;
 
-        connect(reporter_draw, &IReporter2::signal_shelve_story, this, &Producer::signal_shelve_story);
-        connect(reporter_draw, &IReporter2::signal_unshelve_story, this, &Producer::signal_unshelve_story);
+        // these are made once per Headline filed, so guard against
+        // relaying each Reporter signal more than once
+        connect(reporter_draw, &IReporter2::signal_shelve_story, this, &Producer::signal_shelve_story, Qt::UniqueConnection);
+        connect(reporter_draw, &IReporter2::signal_unshelve_story, this, &Producer::signal_unshelve_story, Qt::UniqueConnection);
     }
 
     emit signal_new_headline(headline);
@@ -146,14 +143,18 @@ void Producer::file_headline(const QString& data)
 
 void Producer::slot_headline_going_out_of_scope(HeadlinePointer headline)
 {
-    foreach(auto hp, headlines)
-    {
-        if(hp.data() == headline.data())
-        {
-            headlines.removeAll(hp);
-            break;
-        }
-    }
+    // most Headlines are never tracked, so this is usually one lookup
+    auto handle = headline->get_handle();
+    if(!tracked.value(handle))
+        return;
+
+    tracked.release(handle);
+
+    // Headlines generally go out of scope in the order they were filed
+    if(headlines.front() == headline)
+        headlines.removeFirst();
+    else
+        headlines.removeOne(headline);
 }
 
 void Producer::slot_headline_highlight(qreal opacity, int timeout)
@@ -161,6 +162,35 @@ void Producer::slot_headline_highlight(qreal opacity, int timeout)
     chyron->highlight_headline(headlines.front(), opacity, timeout);
 }
 
+void Producer::slot_reporter_content_changed()
+{
+    // until now, we couldn't know if this Reporter tells us when its
+    // content changes, so its Headlines have been drawing it afresh
+    // every time.  from here on, they can keep what they render.
+    auto first_signal = !content_signaled;
+    content_signaled = true;
+
+    foreach(auto headline, headlines)
+    {
+        if(first_signal)
+            headline->set_reporter_draw_cached();
+        headline->mark_dirty();
+    }
+}
+
+void Producer::slot_chyron_queue_full(bool full)
+{
+    chyron_queue_full = full;
+    if(chyron_queue_full)
+        return;
+
+    auto suppressed = suppressed_count;
+    suppressed_count = 0;
+
+    if(suppressed && story_info->queue_overflow == QueueOverflow::Summarize)
+        file_headline(tr("(%1 more update%2 suppressed)").arg(suppressed).arg(suppressed == 1 ? "" : "s"));
+}
+
 void Producer::slot_start_covering_story()
 {
     (void)start_covering_story();
@@ -177,37 +207,9 @@ void Producer::slot_new_data(const QByteArray& data)
         return;
     }
 
-    auto has_breaks = data.contains("<br>");
-
-    QStringList lines;
-    if(has_breaks)
-        lines = QString(data).split("<br>");
-    else
-        lines = QString(data).split('\n');
-
-    QString new_line;
-    auto current_limit{0};
-    foreach(const auto& line, lines)
-    {
-        if(new_line.length())
-        {
-            if(has_breaks)
-                new_line += "<br>";
-            else
-                new_line += "\n";
-        }
-
-        new_line += line;
-
-        ++current_limit;
-        if((current_limit % story_info->limit_content_to) == 0)
-        {
-            if(!new_line.isEmpty())
-                file_headline(new_line);
-            new_line.clear();
-        }
-    }
+    ReportSplitter splitter(data, story_info->limit_content_to);
 
-    if(!new_line.isEmpty())
-        file_headline(new_line);
+    QString headline;
+    while(splitter.next(headline))
+        file_headline(headline);
 }
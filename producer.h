@@ -13,6 +13,8 @@
 #include "headline.h"
 #include "storyinfo.h"
 #include "chyron.h"
+#include "triggermatcher.h"
+#include "handletable.h"
 
 /// @class Producer
 /// @brief Manages a Reporter covering a Story
@@ -30,7 +32,7 @@ public:
     explicit Producer(ChyronPointer chyron,
                       IReporterPointer reporter,
                       StoryInfoPointer story_info,
-                      StyleListPointer style_list,
+                      TriggerMatcherPointer trigger_matcher,
                       QObject *parent = nullptr);
     ~Producer();
 
@@ -57,6 +59,8 @@ protected slots:
     void    slot_new_data(const QByteArray& data);
     void    slot_headline_going_out_of_scope(HeadlinePointer);
     void    slot_headline_highlight(qreal opacity, int timeout);
+    void    slot_chyron_queue_full(bool full);
+    void    slot_reporter_content_changed();
 
 private:        // typedefs and enums
     SPECIALIZE_LIST(HeadlinePointer, Headline)   // "HeadlineList"
@@ -71,9 +75,16 @@ private:        // data members
     IReporterPointer    reporter;
     ChyronPointer       chyron;
     StoryInfoPointer    story_info;
-    StyleListPointer    style_list;
+    TriggerMatcherPointer trigger_matcher;
 
-    HeadlineList        headlines;
+    HeadlineList        headlines;          // oldest first
+    HandleTable<bool>   tracked;            // which Headlines are in 'headlines'
+
+    bool                content_signaled{false};    // the Reporter emits signal_content_changed()
+
+    bool                chyron_queue_full{false};
+    int                 suppressed_count{0};
 };
 
 SPECIALIZE_SHAREDPTR(Producer, Producer)    // "ProducerPointer"
+SPECIALIZE_WEAKPTR(Producer, Producer)      // "ProducerWeakPointer"
@@ -61,11 +61,17 @@ UI_DIR = $$INTERMEDIATE_NAME/ui
 SOURCES += \
     teamcity9.cpp \
     teamcity9factory.cpp \
-    teamcity9poller.cpp
+    teamcity9poller.cpp \
+    ../requestengine.cpp \
+    ../jsonreader.cpp \
+    ../polltimer.cpp
 
 HEADERS += \
         ../../interfaces/ireporter.h \
     teamcity9.h \
     teamcity9_global.h \
     teamcity9factory.h \
-    teamcity9poller.h
+    teamcity9poller.h \
+    ../requestengine.h \
+    ../jsonreader.h \
+    ../polltimer.h
@@ -1,10 +1,14 @@
 #include <QtCore/QFile>
 #include <QtCore/QJsonDocument>
+#include <QtCore/QDebug>
 
 #include "teamcity9.h"
 
 #define ASSERT_UNUSED(cond) Q_ASSERT(cond); Q_UNUSED(cond)
 
+// 'idle-polling-limit'
+const int ParametersVersion = 2;
+
 TeamCity9::PollerMap TeamCity9::poller_map;
 
 TeamCity9::TeamCity9(QObject *parent)
@@ -60,7 +64,7 @@ float TeamCity9::Supports(const QUrl& entity) const
 
 int TeamCity9::RequiresVersion() const
 {
-    return 1;
+    return ParametersVersion;
 }
 
 RequirementsFormats TeamCity9::RequiresFormat() const
@@ -68,16 +72,39 @@ RequirementsFormats TeamCity9::RequiresFormat() const
     return RequirementsFormats::Simple;
 }
 
-bool TeamCity9::RequiresUpgrade(int /*version*/, QStringList& /*parameters*/)
+bool TeamCity9::RequiresUpgrade(int version, QStringList& parameters)
 {
     error_message.clear();
-    return false;
+
+    if(version == 0)
+        version = ParametersVersion;
+
+    auto upgraded{false};
+    while(version < ParametersVersion)
+    {
+        ++version;
+
+        if(version == 2)
+        {
+            // version 2 added
+            // - "Idle polling limit (sec):"
+
+            parameters.insert(Param::IdlePoll, "");   // use the default
+
+            upgraded = true;
+        }
+    }
+
+    return upgraded;
 }
 
-QStringList TeamCity9::Requires(int /*version*/) const
+QStringList TeamCity9::Requires(int target_version) const
 {
     QStringList definitions;
 
+    if(target_version == 0)
+        target_version = ParametersVersion;
+
     // "simple" requirements format
 
     // parameter names ending with an asterisk are required
@@ -97,11 +124,31 @@ QStringList TeamCity9::Requires(int /*version*/) const
 
                 << "Check idle builders for pending changes" << QString("check:%1").arg(check_for_changes ? "true" : "false")
 
-                // how many seconds between polls? (default: 60)
+                // how many seconds between polls while builds
+                // are active? (default: 60)
                 << "Polling (sec):" << QString("integer:%1").arg(poll_timeout)
 
                 << "Format:"        << QString("multiline:%1").arg(report_template.join("<br>\n"));
 
+    auto version{1};
+    while(version < target_version)
+    {
+        ++version;
+
+        if(version == 2)
+        {
+            // version 2 added
+            // - "Idle polling limit (sec):"
+
+            // insert updates in reverse order!
+
+                                  // how many seconds between polls, at most, while
+                                  // the server is idle? (default: 600)
+            definitions.insert(12, QString("integer:%1").arg(poll_maximum));
+            definitions.insert(12, "Idle polling limit (sec):");
+        }
+    }
+
     return definitions;
 }
 
@@ -130,6 +177,12 @@ bool TeamCity9::SetRequirements(const QStringList& parameters)
         poll_timeout = poll_timeout < 30 ? 60 : poll_timeout;
     }
 
+    if(parameters.count() > Param::IdlePoll && !parameters[Param::IdlePoll].isEmpty())
+        poll_maximum = parameters[Param::IdlePoll].toInt();
+    // polling backs off from 'poll_timeout' toward this when
+    // nothing is happening, so it can't be any faster
+    poll_maximum = qMax(poll_timeout, poll_maximum);
+
     if(parameters.count() > Param::Template && !parameters[Param::Template].isEmpty())
     {
         QString report_template_str = parameters[Param::Template];
@@ -168,7 +221,7 @@ bool TeamCity9::CoverStory()
 {
     error_message.clear();
 
-    poller = acquire_poller(story, username, password, poll_timeout);
+    poller = acquire_poller(story, username, password);
     if(poller.isNull())
         return false;
 
@@ -183,7 +236,7 @@ bool TeamCity9::CoverStory()
     if(check_for_changes)
         flags |= Interest::PendingChanges;
 
-    poller->add_interest(project_name, builder_name, this, flags);
+    poller->add_interest(project_name, builder_name, this, poll_timeout, poll_maximum, flags);
 
     // do an initial "idle" Headline
     auto status = QString("Project \"<b>%1</b>\"").arg(project_name);
@@ -456,12 +509,12 @@ QString TeamCity9::capitalize(const QString& str)
     return tmp;
 }
 
-PollerPointer TeamCity9::acquire_poller(const QUrl& target, const QString& username, const QString& password, int timeout)
+PollerPointer TeamCity9::acquire_poller(const QUrl& target, const QString& username, const QString& password)
 {
     if(!poller_map.contains(target))
     {
         PollerData pd;
-        pd.poller = PollerPointer(new TeamCity9Poller(target, username, password, timeout));
+        pd.poller = PollerPointer(new TeamCity9Poller(target, username, password));
         poller_map[target] = pd;
     }
 
@@ -477,5 +530,11 @@ void TeamCity9::release_poller(const QUrl& target)
 
     PollerData& pd = poller_map[target];
     if(--pd.reference_count == 0)
+    {
+#ifdef QT_DEBUG
+        qDebug() << "TeamCity9Poller:" << target.toString(QUrl::RemoveUserInfo) << ":" << pd.poller->get_unchanged_count() << "of" << pd.poller->get_response_count() << "responses unchanged";
+#endif
+
         poller_map.remove(target);
+    }
 }
@@ -75,6 +75,7 @@ private:    // typedefs and enums
         Builder,
         Changes,
         Poll,
+        IdlePoll,   // v2
         Template,
         Count,
     } Param;
@@ -98,6 +99,7 @@ private:    // data members
     QString     builder_name;
 
     int         poll_timeout{60};
+    int         poll_maximum{600};
     int         last_changes_count{0};
 
     bool        check_for_changes{true};
@@ -121,6 +123,6 @@ private:    // class-static data
     SPECIALIZE_MAP(QUrl, PollerData, Poller)            // "PollerMap"
 
     static  PollerMap       poller_map;
-    static  PollerPointer   acquire_poller(const QUrl& target, const QString &username, const QString &password, int timeout);
+    static  PollerPointer   acquire_poller(const QUrl& target, const QString &username, const QString &password);
     static  void            release_poller(const QUrl& target);
 };
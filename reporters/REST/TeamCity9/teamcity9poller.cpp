@@ -3,23 +3,25 @@
 
 #define ASSERT_UNUSED(cond) Q_ASSERT(cond); Q_UNUSED(cond)
 
-TeamCity9Poller::TeamCity9Poller(const QUrl& target, const QString& username, const QString& password, int timeout, QObject *parent)
+// the most running builds the batched query will ask for in one reply;
+// a busier project is polled per builder instead
+const int RunningBuildsLimit = 500;
+
+// how many per-builder polls to make before trying the batched
+// query again (the busy moment or the error may have passed)
+const int BatchedRetryPolls = 10;
+
+TeamCity9Poller::TeamCity9Poller(const QUrl& target, const QString& username, const QString& password, QObject *parent)
     : QObject(parent),
       target(target),
       username(username),
-      password(password),
-      poll_timeout(timeout)
+      password(password)
 {
-    QNAM = new QNetworkAccessManager(this);
-
-    request_timer = new QTimer(this);
-    request_timer->setInterval(200);
-    connect(request_timer, &QTimer::timeout, this, &TeamCity9Poller::slot_request_pump);
-    request_timer->start();
+    engine = RequestEngine::acquire();
+    connect(engine.data(), &RequestEngine::signal_request_started, this, &TeamCity9Poller::slot_request_started);
 
-    poll_timer = new QTimer(this);
-    poll_timer->setInterval(poll_timeout * 1000);
-    connect(poll_timer, &QTimer::timeout, this, &TeamCity9Poller::slot_poll);
+    poll_timer = new PollTimer(this);
+    connect(poll_timer, &PollTimer::signal_poll, this, &TeamCity9Poller::slot_poll);
 
     // prime the pump and get projects listing first
     enqueue_request(QString("%1/httpAuth/app/rest/projects").arg(target.toString()), ReplyStates::GettingProjects);
@@ -27,13 +29,6 @@ TeamCity9Poller::TeamCity9Poller(const QUrl& target, const QString& username, co
 
 TeamCity9Poller::~TeamCity9Poller()
 {
-    if(request_timer)
-    {
-        request_timer->stop();
-        request_timer->deleteLater();
-        request_timer = nullptr;
-    }
-
     if(poll_timer)
     {
         poll_timer->stop();
@@ -41,14 +36,14 @@ TeamCity9Poller::~TeamCity9Poller()
         poll_timer = nullptr;
     }
 
-    if(QNAM)
+    if(engine)
     {
-        QNAM->deleteLater();
-        QNAM = nullptr;
+        engine->cancel_all(this);
+        engine.clear();
     }
 }
 
-void TeamCity9Poller::add_interest(const QString& project_name, const QString& builder_name, QObject* me, int flags)
+void TeamCity9Poller::add_interest(const QString& project_name, const QString& builder_name, QObject* me, int poll_minimum, int poll_maximum, int flags)
 {
     // make sure it's a TeamCity9 instance
     auto teamcity9 = dynamic_cast<TeamCity9*>(me);
@@ -65,7 +60,13 @@ void TeamCity9Poller::add_interest(const QString& project_name, const QString& b
 
     interested_parties[key].append(id);
 
-    if(poll_timer->isActive())
+    poll_timer->set_bounds(me, poll_minimum, poll_maximum);
+
+    // the new party needs to hear the current state, even
+    // if it has not changed since the last poll
+    engine->invalidate(target);
+
+    if(poll_timer->is_active())
     {
         poll_timer->start();    // reset it
         slot_poll();            // get a new update now
@@ -74,6 +75,8 @@ void TeamCity9Poller::add_interest(const QString& project_name, const QString& b
 
 void TeamCity9Poller::remove_interest(const QString& project_name, const QString& builder_name, QObject* me)
 {
+    poll_timer->clear_bounds(me);
+
     auto key = QString("%1::%2").arg(project_name.toLower()).arg(builder_name.toLower());
     if(!interested_parties.contains(key))
         return;
@@ -172,11 +175,24 @@ void TeamCity9Poller::notify_interested_parties(BuilderEvents event, const QStri
 
 void TeamCity9Poller::enqueue_request(const QString& url_str, ReplyStates state, const QStringList& request_data, Priorities priority)
 {
+    QUrl url(url_str);
+    url.setUserName(username);
+    url.setPassword(password);
+
+    QNetworkRequest request(url);
+    request.setRawHeader(QByteArray("Content-type"), QByteArray("application/json"));
+    request.setRawHeader(QByteArray("Accept"), QByteArray("application/json"));
+
+    // the periodic status checks can be skipped when nothing has
+    // changed; everything else is needed in full
+    auto conditional = (state == ReplyStates::GettingBuilderStatus ||
+                        state == ReplyStates::GettingRunningBuilds ||
+                        state == ReplyStates::GettingBuildPending);
+
+    auto ticket = engine->get(request, this, priority == Priorities::FrontOfQueue ? RequestEngine::Priority::High : RequestEngine::Priority::Normal, conditional);
+
     RequestData rd{state, url_str, request_data};
-    if(priority == Priorities::BackOfQueue)
-        requests.push_back(rd);
-    else
-        requests.insert(0, rd);
+    queued_requests[ticket] = rd;
     pending_requests[rd.url] = true;
 }
 
@@ -187,17 +203,15 @@ void TeamCity9Poller::enqueue_request_unique(const QString& url_str, ReplyStates
     enqueue_request(url_str, state, request_data);
 }
 
-void TeamCity9Poller::create_request(const QString& url_str, ReplyStates state, const QStringList& request_data)
+void TeamCity9Poller::slot_request_started(int ticket, QNetworkReply* reply)
 {
-    QUrl url(url_str);
-    url.setUserName(username);
-    url.setPassword(password);
+    // the engine serves every poller in the plug-in; only
+    // replies to our own requests are of interest here
+    if(!queued_requests.contains(ticket))
+        return;
 
-    QNetworkRequest request(url);
-    request.setRawHeader(QByteArray("Content-type"), QByteArray("application/json"));
-    request.setRawHeader(QByteArray("Accept"), QByteArray("application/json"));
+    auto rd = queued_requests.take(ticket);
 
-    auto reply = QNAM->get(request);
     auto connected = connect(reply, &QNetworkReply::readyRead, this, &TeamCity9Poller::slot_get_read);
     ASSERT_UNUSED(connected)
     connected = connect(reply, &QNetworkReply::finished, this, &TeamCity9Poller::slot_get_complete);
@@ -206,11 +220,10 @@ void TeamCity9Poller::create_request(const QString& url_str, ReplyStates state,
                         this, &TeamCity9Poller::slot_get_failed);
     ASSERT_UNUSED(connected)
 
-    ReplyData reply_data{state, QByteArray(), request_data};
+    ReplyData reply_data{rd.state, JsonReaderPointer(new JsonReader(reply_fields(rd.state))), rd.data};
     active_replies[reply] = reply_data;
 
-    if(pending_requests.contains(url_str))
-        pending_requests.remove(url_str);
+    pending_requests.remove(rd.url);
 }
 
 void TeamCity9Poller::process_reply(QNetworkReply *reply)
@@ -220,8 +233,7 @@ void TeamCity9Poller::process_reply(QNetworkReply *reply)
     {
         projects.clear();
 
-        auto d = QJsonDocument::fromJson(data.buffer);
-        auto sett2 = d.object();
+        auto sett2 = data.reader->object();
         auto count = sett2["count"].toInt();
         auto project_array = sett2.value(QString("project")).toArray();
         for(auto x = 0;x < count;++x)
@@ -239,8 +251,7 @@ void TeamCity9Poller::process_reply(QNetworkReply *reply)
     }
     else if(data.state == ReplyStates::GettingBuilders)
     {
-        auto d = QJsonDocument::fromJson(data.buffer);
-        auto project_data = d.object();
+        auto project_data = data.reader->object();
         auto project_id = project_data["id"].toString();
 
         auto& pd = projects[project_id];
@@ -260,7 +271,7 @@ void TeamCity9Poller::process_reply(QNetworkReply *reply)
         if(--replies_expected == 0)
         {
             // we're loaded with all our data: we can begin monitoring
-            if(!poll_timer->isActive())
+            if(!poll_timer->is_active())
             {
                 slot_poll();        // get an initial update for all builders
                 poll_timer->start();
@@ -270,32 +281,82 @@ void TeamCity9Poller::process_reply(QNetworkReply *reply)
     else if(data.state == ReplyStates::GettingBuilderStatus)
     {
         // got a status update for a specific Project::Builder
-        auto d = QJsonDocument::fromJson(data.buffer);
-        auto sett2 = d.object();
+        if(engine->is_digest_unchanged(reply, data.reader->digest()))
+        {
+            ++unchanged_count;
+            process_builder_unchanged(data.data);
+            return;
+        }
+
+        auto sett2 = data.reader->object();
         process_builder_status(sett2, data.data);
     }
+    else if(data.state == ReplyStates::GettingRunningBuilds)
+    {
+        // got the running builds for a watched project
+        if(engine->is_digest_unchanged(reply, data.reader->digest()))
+        {
+            ++unchanged_count;
+
+            auto& project = projects[data.data[0]];
+            for(auto builder = project.builders.begin();builder != project.builders.end();++builder)
+            {
+                if(is_watched(project, *builder))
+                    process_builder_unchanged(QStringList() << data.data[0] << builder->builder_data["id"].toString());
+            }
+
+            return;
+        }
+
+        auto sett2 = data.reader->object();
+        process_running_builds(sett2, data.data[0]);
+    }
     else if(data.state == ReplyStates::GettingBuildPending)
     {
         // got a status update for a specific build id
-        auto d = QJsonDocument::fromJson(data.buffer);
-        auto sett2 = d.object();
+        if(engine->is_digest_unchanged(reply, data.reader->digest()))
+        {
+            ++unchanged_count;
+            return;     // interested parties already have this
+        }
+
+        auto sett2 = data.reader->object();
         process_build_pending(sett2, data.data);
     }
     else if(data.state == ReplyStates::GettingBuildStatus)
     {
         // got a status update for a specific build id
-        auto d = QJsonDocument::fromJson(data.buffer);
-        auto sett2 = d.object();
+        auto sett2 = data.reader->object();
         process_build_status(sett2, data.data);
     }
     else if(data.state == ReplyStates::GettingBuildFinal)
     {
-        auto d = QJsonDocument::fromJson(data.buffer);
-        auto sett2 = d.object();
+        auto sett2 = data.reader->object();
         process_build_final(sett2, data.data);
     }
 }
 
+QStringList TeamCity9Poller::reply_fields(ReplyStates state) const
+{
+    // only these parts of each reply are kept; replies that are
+    // passed along to the TeamCity9 instances are kept whole
+    switch(state)
+    {
+        case ReplyStates::GettingProjects:
+            return QStringList() << "count" << "project[].id" << "project[].href";
+        case ReplyStates::GettingBuilders:
+            return QStringList() << "id" << "name" << "buildTypes.count" << "buildTypes.buildType[].id" << "buildTypes.buildType[].name";
+        case ReplyStates::GettingBuilderStatus:
+            return QStringList() << "count" << "build[]";
+        case ReplyStates::GettingRunningBuilds:
+            return QStringList() << "count" << "nextHref" << "build[]";
+        default:
+            break;
+    }
+
+    return QStringList();
+}
+
 bool TeamCity9Poller::any_interest_in_changes_check(const QString& project_name, const QString& builder_name)
 {
     // see if interested parties for this project::builder want
@@ -360,24 +421,17 @@ void TeamCity9Poller::process_builder_status(const QJsonObject& status, const QS
     }
     Q_ASSERT(builder != project.builders.end());
 
-    auto project_name = project.project_data["name"].toString();
-    auto builder_name = builder->builder_data["name"].toString();
-
     auto count = status["count"].toInt();
     if(count == 0 && builder->build_status.isEmpty())
     {
-        if(!builder->pause_pending_changes_check && any_interest_in_changes_check(project_name, builder_name))
-        {
-            builder->build_event = BuilderEvents::BuildPending;
-            ++builder->pending_changes_check_count;
-
-            auto url = QString("%1/httpAuth/app/rest/changes?locator=buildType:(id:%2),pending:true").arg(target.toString()).arg(builder->builder_data["id"].toString());
-            enqueue_request_unique(url, ReplyStates::GettingBuildPending, QStringList() << status_data[0] << builder->builder_data["id"].toString());
-        }
-
+        check_pending_changes(project, *builder, status_data);
         return;
     }
 
+    // builds are running (or have just finished) on this builder,
+    // so keep polling at full speed
+    poll_timer->activity();
+
     // we have to produce a delta:  we have to check current builds
     // for new builds, and check cached status for builds that
     // have completed.
@@ -450,12 +504,112 @@ void TeamCity9Poller::process_builder_status(const QJsonObject& status, const QS
     if(finals.count())
     {
         foreach(auto build_id, finals)
-            create_request(QString("%1/httpAuth/app/rest/builds/id:%2").arg(target.toString()).arg(build_id),
+            enqueue_request(QString("%1/httpAuth/app/rest/builds/id:%2").arg(target.toString()).arg(build_id),
                             ReplyStates::GettingBuildFinal,
-                            status_data);
+                            status_data,
+                            Priorities::FrontOfQueue);
+    }
+}
+
+void TeamCity9Poller::process_running_builds(const QJsonObject& status, const QString& project_id)
+{
+    // 'status' lists every running build in the project, with only the
+    // fields that process_builder_status() uses (the same ones a single
+    // builder's listing carries):
+    // {
+    //   "count":2,
+    //   "build":
+    //   [
+    //     { "id":12382, "buildTypeId":"DaveV_Windows", "number":"246", "status":"SUCCESS", "state":"running", ... },
+    //     { "id":12383, "buildTypeId":"DaveV_Linux", "number":"112", "status":"SUCCESS", "state":"running", ... }
+    //   ]
+    // }
+
+    if(status.contains("nextHref"))
+    {
+        // more builds are running than fit in one reply; the
+        // per-builder queries will cover them all for a while
+        poll_mode = PollModes::PerBuilder;
+        per_builder_polls = 0;
+        slot_poll();
+        return;
+    }
+
+    // fan the builds out to their builders, in the shape of a
+    // single builder's listing
+    QMap<QString, QJsonArray> running;
+
+    auto build_array = status["build"].toArray();
+    for(auto x = 0;x < build_array.count();++x)
+    {
+        auto build = build_array.at(x).toObject();
+        running[build["buildTypeId"].toString()].append(build);
+    }
+
+    auto& project = projects[project_id];
+    for(auto builder = project.builders.begin();builder != project.builders.end();++builder)
+    {
+        if(!is_watched(project, *builder))
+            continue;
+
+        auto builder_id = builder->builder_data["id"].toString();
+        auto builds = running.value(builder_id);
+
+        QJsonObject builder_status;
+        builder_status["count"] = builds.count();
+        builder_status["build"] = builds;
+
+        // this only requests details for builds that have
+        // started, progressed or finished since the last poll
+        process_builder_status(builder_status, QStringList() << project_id << builder_id);
     }
 }
 
+bool TeamCity9Poller::is_watched(const ProjectData& project, const BuilderData& builder) const
+{
+    auto project_name = project.project_data["name"].toString().toLower();
+    auto builder_name = builder.builder_data["name"].toString().toLower();
+
+    return interested_parties.contains(QString("%1::").arg(project_name)) ||
+           interested_parties.contains(QString("%1::%2").arg(project_name).arg(builder_name));
+}
+
+void TeamCity9Poller::process_builder_unchanged(const QStringList& status_data)
+{
+    // the builds running on this builder are exactly as they were at the
+    // last poll, so there are no deltas to produce.  an idle builder is
+    // still checked for pending changes, though.
+
+    auto& project = projects[status_data[0]];
+    auto builder = project.builders.begin();
+    for(;builder != project.builders.end();++builder)
+    {
+        if(!builder->builder_data["id"].toString().compare(status_data[1]))
+            break;
+    }
+    Q_ASSERT(builder != project.builders.end());
+
+    if(builder->build_status.isEmpty())
+        check_pending_changes(project, *builder, status_data);
+    else
+        poll_timer->activity();     // still running, if not progressing
+}
+
+void TeamCity9Poller::check_pending_changes(ProjectData& project, BuilderData& builder, const QStringList& status_data)
+{
+    auto project_name = project.project_data["name"].toString();
+    auto builder_name = builder.builder_data["name"].toString();
+
+    if(builder.pause_pending_changes_check || !any_interest_in_changes_check(project_name, builder_name))
+        return;
+
+    builder.build_event = BuilderEvents::BuildPending;
+    ++builder.pending_changes_check_count;
+
+    auto url = QString("%1/httpAuth/app/rest/changes?locator=buildType:(id:%2),pending:true").arg(target.toString()).arg(builder.builder_data["id"].toString());
+    enqueue_request_unique(url, ReplyStates::GettingBuildPending, QStringList() << status_data[0] << builder.builder_data["id"].toString());
+}
+
 void TeamCity9Poller::process_build_pending(const QJsonObject& status, const QStringList& status_data)
 {
     // 'status' will be a detailed listing about pending changes for an idle builder
@@ -471,6 +625,9 @@ void TeamCity9Poller::process_build_pending(const QJsonObject& status, const QSt
 
     if(status["count"].toInt() != 0)
     {
+        // new changes are waiting, so a build may be starting soon
+        poll_timer->activity();
+
         notify_interested_parties(builder->build_event, project.project_data["name"].toString(), builder->builder_data["name"].toString(), status);
 
         // if there are more pending changes to be retrieved, then we've
@@ -554,7 +711,7 @@ void TeamCity9Poller::slot_get_read()
     if(reply)
     {
         auto& data = active_replies[reply];
-        data.buffer += reply->readAll();
+        data.reader->feed(reply->readAll());
     }
 }
 
@@ -564,18 +721,14 @@ void TeamCity9Poller::slot_get_complete()
     if(reply && reply->error() == QNetworkReply::NoError)
     {
         auto& data = active_replies[reply];
-        data.buffer += reply->readAll();
+        data.reader->feed(reply->readAll());
+        ++response_count;
         process_reply(reply);
     }
 
-    if(reply)
-    {
-        if(active_replies.contains(reply))
-            active_replies.remove(reply);
-
-        reply->deleteLater();
-        reply = nullptr;
-    }
+    // the RequestEngine owns (and deletes) the reply
+    if(reply && active_replies.contains(reply))
+        active_replies.remove(reply);
 }
 
 void TeamCity9Poller::slot_get_failed(QNetworkReply::NetworkError code)
@@ -593,6 +746,24 @@ void TeamCity9Poller::slot_get_failed(QNetworkReply::NetworkError code)
         error_message = tr("<b>Network Error</b><br>A network error code %1 was returned for the last operation.").arg(code);
 
     auto& data = active_replies[reply];
+
+    if(data.state == ReplyStates::GettingRunningBuilds &&
+       (code == QNetworkReply::ContentNotFoundError || code == QNetworkReply::ProtocolInvalidOperationError))
+    {
+        // the server (or something in front of it) does not understand
+        // the batched query; ask about each builder for a while
+        poll_mode = PollModes::PerBuilder;
+        per_builder_polls = 0;
+        return;
+    }
+
+    if(data.state == ReplyStates::GettingRunningBuilds)
+    {
+        // only the project is known for these
+        notify_interested_parties(projects[data.data[0]].project_data["name"].toString(), QString(), error_message);
+        return;
+    }
+
     if(!data.data.isEmpty())
     {
         auto& pd = projects[data.data[0]];
@@ -610,37 +781,53 @@ void TeamCity9Poller::slot_get_failed(QNetworkReply::NetworkError code)
         notify_interested_parties(QString(), QString(), error_message);
 }
 
-void TeamCity9Poller::slot_request_pump()
+void TeamCity9Poller::slot_poll()
 {
-    if(active_replies.count())
+    // we only request updates for those builders that are actively being watched
+    if(interested_parties.isEmpty())
         return;
 
-    if(requests.count())
+    if(poll_mode == PollModes::PerBuilder && ++per_builder_polls > BatchedRetryPolls)
     {
-        auto rd = requests.front();
-        requests.pop_front();
-        create_request(rd.url, rd.state, rd.data);
+        // whatever made us fall back may have passed; if it hasn't,
+        // the batched reply will send us back again
+        poll_mode = PollModes::Batched;
+        per_builder_polls = 0;
     }
-}
 
-void TeamCity9Poller::slot_poll()
-{
-    // we only request updates for those builders that are actively being watched
-    if(interested_parties.isEmpty())
+    if(poll_mode == PollModes::Batched)
+    {
+        // one query per watched project returns all of its running builds,
+        // with just the fields we use; process_running_builds() fans each
+        // out to the watched builders.  unwatched projects are never asked
+        // about, so they can't crowd the watched ones out of the reply.
+        foreach(const QString& key, projects.keys())
+        {
+            auto& project = projects[key];
+
+            auto watched{false};
+            for(auto builder = project.builders.begin();builder != project.builders.end() && !watched;++builder)
+                watched = is_watched(project, *builder);
+            if(!watched)
+                continue;
+
+            auto url = QString("%1/httpAuth/app/rest/builds?locator=affectedProject:(id:%2),running:true,defaultFilter:false,count:%3"
+                               "&fields=count,nextHref,build(id,buildTypeId,number,status,state,running,percentageComplete,href,webUrl)")
+                                    .arg(target.toString())
+                                    .arg(key)
+                                    .arg(RunningBuildsLimit);
+            enqueue_request_unique(url, ReplyStates::GettingRunningBuilds, QStringList() << key);
+        }
+
         return;
+    }
 
     foreach(const QString& key, projects.keys())
     {
         auto& project = projects[key];
         for(auto builder = project.builders.begin();builder != project.builders.end();++builder)
         {
-            auto project_name = project.project_data["name"].toString();
-            auto builder_name = builder->builder_data["name"].toString();
-
-            auto project_key = QString("%1::").arg(project_name.toLower());
-            auto builder_key = QString("%1::%2").arg(project_name.toLower()).arg(builder_name.toLower());
-
-            if(interested_parties.contains(project_key.toLower()) || interested_parties.contains(builder_key.toLower()))
+            if(is_watched(project, *builder))
             {
                 auto builder_id = builder->builder_data["id"].toString();
 
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <QtNetwork/QNetworkReply>
-#include <QtNetwork/QNetworkAccessManager>
 
 #include <QtCore/QTimer>
 #include <QtCore/QDateTime>
@@ -13,6 +12,10 @@
 
 #include "../../../specialize.h"
 
+#include "../requestengine.h"
+#include "../jsonreader.h"
+#include "../polltimer.h"
+
 #include "teamcity9_global.h"
 
 /// @class TeamCity9Poller
@@ -27,19 +30,26 @@ class TEAMCITY9SHARED_EXPORT TeamCity9Poller : public QObject
 {
     Q_OBJECT
 public:
-    TeamCity9Poller(const QUrl& target, const QString& username, const QString& password, int timeout, QObject* parent = nullptr);
+    TeamCity9Poller(const QUrl& target, const QString& username, const QString& password, QObject* parent = nullptr);
     ~TeamCity9Poller();
 
     // this filtering mechanism is used because Qt does not provide
-    // a canonical means of creating runtime, dynamic signals/slots
-    void    add_interest(const QString& project_name, const QString& builder_name, QObject* me, int flags = Interest::None);
+    // a canonical means of creating runtime, dynamic signals/slots.
+    // each party also sets the bounds (in seconds) within which
+    // the server is polled on its behalf.
+    void    add_interest(const QString& project_name, const QString& builder_name, QObject* me, int poll_minimum, int poll_maximum, int flags = Interest::None);
     void    remove_interest(const QString& project_name, const QString& builder_name, QObject* me);
 
+    // how many poll responses have been received, and how many of those
+    // were unchanged since the last one (and so were not processed)
+    int     get_response_count()  const   { return response_count; }
+    int     get_unchanged_count() const   { return unchanged_count; }
+
 private slots:
     void    slot_get_read();
     void    slot_get_complete();
     void    slot_get_failed(QNetworkReply::NetworkError code);
-    void    slot_request_pump();
+    void    slot_request_started(int ticket, QNetworkReply* reply);
     void    slot_poll();
 
 private:    // typedefs and enums
@@ -58,6 +68,7 @@ private:    // typedefs and enums
         GettingProjects,
         GettingBuilders,
         GettingBuilderStatus,
+        GettingRunningBuilds,
         GettingBuildPending,
         GettingBuildStatus,
         GettingBuildFinal,
@@ -69,6 +80,12 @@ private:    // typedefs and enums
         FrontOfQueue,
     };
 
+    enum class PollModes
+    {
+        PerBuilder,     // one running-builds query per watched builder
+        Batched,        // one running-builds query per watched project
+    };
+
     SPECIALIZE_MAP(int /* build id */, QJsonObject, Status)            // "StatusMap"
 
 private:    // classes
@@ -82,7 +99,7 @@ private:    // classes
     struct ReplyData
     {
         ReplyStates state;
-        QByteArray  buffer;
+        JsonReaderPointer reader;   // parses the reply as it arrives
         QStringList data;       // project + builder names and ids
     };
 
@@ -113,7 +130,7 @@ private:    // typedefs and enums
     SPECIALIZE_MAP(QString, ProjectData, Projects)      // "ProjectsMap"
     SPECIALIZE_MAP(QNetworkReply*, ReplyData, Reply)    // "ReplyMap"
     SPECIALIZE_MAP(QString, BuilderData, BuilderData)   // "BuilderDataMap"
-    SPECIALIZE_LIST(RequestData, Request)               // "RequestList"
+    SPECIALIZE_MAP(int /* ticket */, RequestData, Request)  // "RequestMap"
     SPECIALIZE_MAP(QString, bool, PendingRequests)      // "PendingRequestsMap"
     SPECIALIZE_LIST(InterestData, Interested)           // "InterestedList"
     SPECIALIZE_MAP(QString, InterestedList, Interested) // "InterestedMap"
@@ -123,10 +140,14 @@ private:    // methods
     void            notify_interested_parties(const QString& project_name, const QString& builder_name, const QString& message);
     void            enqueue_request(const QString& url_str, ReplyStates state, const QStringList& request_data = QStringList(), Priorities priority = Priorities::BackOfQueue);
     void            enqueue_request_unique(const QString& url_str, ReplyStates state, const QStringList& request_data = QStringList());
-    void            create_request(const QString& url_str, ReplyStates state, const QStringList& request_data = QStringList());
     void            process_reply(QNetworkReply *reply);
+    QStringList     reply_fields(ReplyStates state) const;
     bool            any_interest_in_changes_check(const QString& project_name, const QString& builder_name);
     void            process_builder_status(const QJsonObject& status, const QStringList &status_data);
+    void            process_builder_unchanged(const QStringList &status_data);
+    void            process_running_builds(const QJsonObject& status, const QString& project_id);
+    bool            is_watched(const ProjectData& project, const BuilderData& builder) const;
+    void            check_pending_changes(ProjectData& project, BuilderData& builder, const QStringList &status_data);
     void            process_build_pending(const QJsonObject& status, const QStringList &status_data);
     void            process_build_status(const QJsonObject& status, const QStringList &status_data);
     void            process_build_final(const QJsonObject& status, const QStringList &status_data);
@@ -137,18 +158,21 @@ private:    // data members
     QString     username;
     QString     password;
 
-    QNetworkAccessManager*  QNAM{nullptr};
+    RequestEnginePointer    engine;
     ReplyMap    active_replies;
 
-    QTimer*     request_timer{nullptr};
-    QTimer*     poll_timer{nullptr};
-    int         poll_timeout{0};
+    PollTimer*  poll_timer{nullptr};
+    PollModes   poll_mode{PollModes::Batched};
+    int         per_builder_polls{0};   // since falling back from Batched
 
-    RequestList requests;
+    RequestMap  queued_requests;    // waiting on the RequestEngine, by ticket
     PendingRequestsMap  pending_requests;
 
     ProjectsMap projects;
 
+    int         response_count{0};
+    int         unchanged_count{0};
+
     InterestedMap   interested_parties;
 };
 
@@ -61,11 +61,17 @@ UI_DIR = $$INTERMEDIATE_NAME/ui
 SOURCES += \
     transmission.cpp \
     transmissionfactory.cpp \
-    transmissionpoller.cpp
+    transmissionpoller.cpp \
+    ../requestengine.cpp \
+    ../jsonreader.cpp \
+    ../polltimer.cpp
 
 HEADERS += \
     ../../interfaces/ireporter.h \
     transmission.h \
     transmissionglobal.h \
     transmissionfactory.h \
-    transmissionpoller.h
+    transmissionpoller.h \
+    ../requestengine.h \
+    ../jsonreader.h \
+    ../polltimer.h
@@ -3,11 +3,15 @@
 
 #include <QtCore/QFile>
 #include <QtCore/QJsonDocument>
+#include <QtCore/QDebug>
 
 #include "transmission.h"
 
 #define ASSERT_UNUSED(cond) Q_ASSERT(cond); Q_UNUSED(cond)
 
+// 'idle-polling-limit'
+const int ParametersVersion = 2;
+
 Transmission::PollerMap Transmission::poller_map;
 
 Transmission::Transmission(QObject *parent)
@@ -63,7 +67,7 @@ float Transmission::Supports(const QUrl& entity) const
 
 int Transmission::RequiresVersion() const
 {
-    return 1;
+    return ParametersVersion;
 }
 
 RequirementsFormats Transmission::RequiresFormat() const
@@ -71,16 +75,39 @@ RequirementsFormats Transmission::RequiresFormat() const
     return RequirementsFormats::Simple;
 }
 
-bool Transmission::RequiresUpgrade(int /*version*/, QStringList& /*parameters*/)
+bool Transmission::RequiresUpgrade(int version, QStringList& parameters)
 {
     error_message.clear();
-    return false;
+
+    if(version == 0)
+        version = ParametersVersion;
+
+    auto upgraded{false};
+    while(version < ParametersVersion)
+    {
+        ++version;
+
+        if(version == 2)
+        {
+            // version 2 added
+            // - "Idle polling limit (sec):"
+
+            parameters.insert(Param::IdlePoll, "");   // use the default
+
+            upgraded = true;
+        }
+    }
+
+    return upgraded;
 }
 
-QStringList Transmission::Requires(int /*version*/) const
+QStringList Transmission::Requires(int target_version) const
 {
     QStringList definitions;
 
+    if(target_version == 0)
+        target_version = ParametersVersion;
+
     // "simple" requirements format
 
     // parameter names ending with an asterisk are required
@@ -94,11 +121,31 @@ QStringList Transmission::Requires(int /*version*/) const
                 << "Hold shelve-able states for one polling period" << QString("check:%1").arg(shelve_delay)
                 << "Fade shelve-able states on hold" << QString("check:%1").arg(shelve_fade)
 
-                // how many seconds between polls?
+                // how many seconds between polls while torrents
+                // are active?
                 << "Polling (sec):"   << QString("integer:%1").arg(poll_timeout)
 
                 << "Format:"          << QString("multiline:%1").arg(report_template.join("<br>\n"));
 
+    auto version{1};
+    while(version < target_version)
+    {
+        ++version;
+
+        if(version == 2)
+        {
+            // version 2 added
+            // - "Idle polling limit (sec):"
+
+            // insert updates in reverse order!
+
+                                  // how many seconds between polls, at most, while
+                                  // nothing is moving?
+            definitions.insert(16, QString("integer:%1").arg(poll_maximum));
+            definitions.insert(16, "Idle polling limit (sec):");
+        }
+    }
+
     return definitions;
 }
 
@@ -136,6 +183,10 @@ bool Transmission::SetRequirements(const QStringList& parameters)
     if(parameters.count() > Param::Poll && !parameters[Param::Poll].isEmpty())
         poll_timeout = parameters[Param::Poll].toInt();
 
+    if(parameters.count() > Param::IdlePoll && !parameters[Param::IdlePoll].isEmpty())
+        poll_maximum = parameters[Param::IdlePoll].toInt();
+    poll_maximum = qMax(poll_timeout, poll_maximum);
+
     if(parameters.count() > Param::Template && !parameters[Param::Template].isEmpty())
     {
         auto report_template_str = parameters[Param::Template];
@@ -156,7 +207,7 @@ bool Transmission::CoverStory()
 {
     error_message.clear();
 
-    poller = acquire_poller(story, poll_timeout);
+    poller = acquire_poller(story);
     if(poller.isNull())
         return false;
 
@@ -167,7 +218,7 @@ bool Transmission::CoverStory()
     // signals and slots at runtime--we can't construct signals/slots for
     // specific project/builder combinations.
 
-    poller->add_interest(my_slot, this);
+    poller->add_interest(my_slot, this, poll_timeout, poll_maximum);
 
     // do an initial "idle" Headline
     auto status = tr("(Slot #%1: <b>Empty</b>)").arg(my_slot);
@@ -444,6 +495,7 @@ void Transmission::status(const QJsonObject& status, float maxratio)
 
     latest_status = status;
     max_ratio = maxratio;
+    emit signal_content_changed();
 
     ReportMap report_map;
     populate_report_map(report_map, status);
@@ -455,6 +507,7 @@ void Transmission::status(const QJsonObject& status, float maxratio)
 void Transmission::reset()
 {
     latest_status = QJsonObject();
+    emit signal_content_changed();
 
     if(active)
     {
@@ -523,12 +576,12 @@ QString Transmission::capitalize(const QString& str)
     return tmp;
 }
 
-PollerPointer Transmission::acquire_poller(const QUrl& target, int timeout)
+PollerPointer Transmission::acquire_poller(const QUrl& target)
 {
     if(!poller_map.contains(target))
     {
         PollerData pd;
-        pd.poller = PollerPointer(new TransmissionPoller(target, timeout));
+        pd.poller = PollerPointer(new TransmissionPoller(target));
         poller_map[target] = pd;
     }
 
@@ -544,5 +597,11 @@ void Transmission::release_poller(const QUrl& target)
 
     PollerData& pd = poller_map[target];
     if(--pd.reference_count == 0)
+    {
+#ifdef QT_DEBUG
+        qDebug() << "TransmissionPoller:" << target.toString(QUrl::RemoveUserInfo) << ":" << pd.poller->get_unchanged_count() << "of" << pd.poller->get_response_count() << "responses unchanged";
+#endif
+
         poller_map.remove(target);
+    }
 }
@@ -74,6 +74,7 @@ private:    // typedefs and enums
         ShelveDelay,
         ShelveFade,
         Poll,
+        IdlePoll,   // v2
         Template,
         Count,
     } Param;
@@ -98,6 +99,7 @@ private:    // data members
     int         my_slot{1};
     float       max_ratio{0.0f};
     int         poll_timeout{5};
+    int         poll_maximum{60};
 
     qint64      shelve_delay_target{0};
     QTimer*     shelve_delay_timer{nullptr};
@@ -121,6 +123,6 @@ private:    // class-static data
     SPECIALIZE_MAP(QUrl, PollerData, Poller)            // "PollerMap"
 
     static  PollerMap       poller_map;
-    static  PollerPointer   acquire_poller(const QUrl& target, int timeout);
+    static  PollerPointer   acquire_poller(const QUrl& target);
     static  void            release_poller(const QUrl& target);
 };
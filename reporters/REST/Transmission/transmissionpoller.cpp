@@ -3,21 +3,15 @@
 
 #define ASSERT_UNUSED(cond) Q_ASSERT(cond); Q_UNUSED(cond)
 
-TransmissionPoller::TransmissionPoller(const QUrl& target, int timeout, QObject *parent)
+TransmissionPoller::TransmissionPoller(const QUrl& target, QObject *parent)
     : QObject(parent),
-      target(target),
-      poll_timeout(timeout)
+      target(target)
 {
-    QNAM = new QNetworkAccessManager(this);
+    engine = RequestEngine::acquire();
+    connect(engine.data(), &RequestEngine::signal_request_started, this, &TransmissionPoller::slot_request_started);
 
-    request_timer = new QTimer(this);
-    request_timer->setInterval(200);
-    connect(request_timer, &QTimer::timeout, this, &TransmissionPoller::slot_request_pump);
-    request_timer->start();
-
-    poll_timer = new QTimer(this);
-    poll_timer->setInterval(poll_timeout * 1000);
-    connect(poll_timer, &QTimer::timeout, this, &TransmissionPoller::slot_poll);
+    poll_timer = new PollTimer(this);
+    connect(poll_timer, &PollTimer::signal_poll, this, &TransmissionPoller::slot_poll);
 
     // prime the pump and get projects listing first
     enqueue_request(target.toString(), ReplyStates::GettingStatus);
@@ -25,13 +19,6 @@ TransmissionPoller::TransmissionPoller(const QUrl& target, int timeout, QObject
 
 TransmissionPoller::~TransmissionPoller()
 {
-    if(request_timer)
-    {
-        request_timer->stop();
-        request_timer->deleteLater();
-        request_timer = nullptr;
-    }
-
     if(poll_timer)
     {
         poll_timer->stop();
@@ -39,14 +26,14 @@ TransmissionPoller::~TransmissionPoller()
         poll_timer = nullptr;
     }
 
-    if(QNAM)
+    if(engine)
     {
-        QNAM->deleteLater();
-        QNAM = nullptr;
+        engine->cancel_all(this);
+        engine.clear();
     }
 }
 
-void TransmissionPoller::add_interest(int slot, QObject* me, int flags)
+void TransmissionPoller::add_interest(int slot, QObject* me, int poll_minimum, int poll_maximum, int flags)
 {
     // make sure it's a Transmission instance
     auto transmission = dynamic_cast<Transmission*>(me);
@@ -59,15 +46,23 @@ void TransmissionPoller::add_interest(int slot, QObject* me, int flags)
     interested_parties[slot-1].party = me;
     interested_parties[slot-1].flags = flags;
 
-    if(poll_timer->isActive())
+    poll_timer->set_bounds(me, poll_minimum, poll_maximum);
+
+    // the new party needs to hear the current state, even
+    // if it has not changed since the last poll
+    engine->invalidate(target);
+
+    if(poll_timer->is_active())
     {
         poll_timer->start();    // reset it
         slot_poll();            // get a new update now
     }
 }
 
-void TransmissionPoller::remove_interest(int slot, QObject* /*me*/)
+void TransmissionPoller::remove_interest(int slot, QObject* me)
 {
+    poll_timer->clear_bounds(me);
+
     if(interested_parties.length() < slot)
         return;
     interested_parties[slot-1] = InterestData();
@@ -120,11 +115,16 @@ void TransmissionPoller::notify_interested_parties(int slot, const QJsonObject&
 
 void TransmissionPoller::enqueue_request(const QString& url_str, ReplyStates state, const QStringList& request_data, Priorities priority)
 {
+    QUrl url(url_str);
+
+    QNetworkRequest request(url);
+    request.setRawHeader(QByteArray("Content-type"), QByteArray("application/json"));
+    request.setRawHeader(QByteArray("Accept"), QByteArray("application/json"));
+
+    auto ticket = engine->get(request, this, priority == Priorities::FrontOfQueue ? RequestEngine::Priority::High : RequestEngine::Priority::Normal, true);
+
     RequestData rd{state, url_str, request_data};
-    if(priority == Priorities::BackOfQueue)
-        requests.push_back(rd);
-    else
-        requests.insert(0, rd);
+    queued_requests[ticket] = rd;
     pending_requests[rd.url] = true;
 }
 
@@ -135,15 +135,15 @@ void TransmissionPoller::enqueue_request_unique(const QString& url_str, ReplySta
     enqueue_request(url_str, state, request_data);
 }
 
-void TransmissionPoller::create_request(const QString& url_str, ReplyStates state, const QStringList& request_data)
+void TransmissionPoller::slot_request_started(int ticket, QNetworkReply* reply)
 {
-    QUrl url(url_str);
+    // the engine serves every poller in the plug-in; only
+    // replies to our own requests are of interest here
+    if(!queued_requests.contains(ticket))
+        return;
 
-    QNetworkRequest request(url);
-    request.setRawHeader(QByteArray("Content-type"), QByteArray("application/json"));
-    request.setRawHeader(QByteArray("Accept"), QByteArray("application/json"));
+    auto rd = queued_requests.take(ticket);
 
-    auto reply = QNAM->get(request);
     auto connected = connect(reply, &QNetworkReply::readyRead, this, &TransmissionPoller::slot_get_read);
     ASSERT_UNUSED(connected)
     connected = connect(reply, &QNetworkReply::finished, this, &TransmissionPoller::slot_get_complete);
@@ -153,13 +153,13 @@ void TransmissionPoller::create_request(const QString& url_str, ReplyStates stat
     ASSERT_UNUSED(connected)
 
     ReplyData reply_data;
-    reply_data.state = state;
-    reply_data.data = request_data;
+    reply_data.state = rd.state;
+    reply_data.reader = JsonReaderPointer(new JsonReader(reply_fields(rd.state)));
+    reply_data.data = rd.data;
 
     active_replies[reply] = reply_data;
 
-    if(pending_requests.contains(url_str))
-        pending_requests.remove(url_str);
+    pending_requests.remove(rd.url);
 }
 
 void TransmissionPoller::process_reply(QNetworkReply *reply)
@@ -167,20 +167,33 @@ void TransmissionPoller::process_reply(QNetworkReply *reply)
     auto& data = active_replies[reply];
     if(data.state == ReplyStates::GettingStatus)
     {
-        QJsonParseError error;
-        auto d = QJsonDocument::fromJson(data.buffer, &error);
-        if(error.error == QJsonParseError::NoError)
+        // the torrents are just as they were at the last poll
+        if(engine->is_digest_unchanged(reply, data.reader->digest()))
+            ++unchanged_count;
+        else if(data.reader->is_valid())
         {
-            auto sett2 = d.object();
+            // something is moving (progress, rates, states), so
+            // keep polling at full speed
+            poll_timer->activity();
+
+            auto sett2 = data.reader->object();
             if(!sett2.isEmpty())
                 process_client_status(sett2, data.data);
         }
 
-        if(!poll_timer->isActive())
+        if(!poll_timer->is_active())
             poll_timer->start();
     }
 }
 
+QStringList TransmissionPoller::reply_fields(ReplyStates state) const
+{
+    // only these parts of each reply are kept
+    if(state == ReplyStates::GettingStatus)
+        return QStringList() << "type" << "data" << "count" << "maxratio" << "slots[]";
+    return QStringList();
+}
+
 void TransmissionPoller::process_client_status(const QJsonObject& status, const QStringList& /*status_data*/)
 {
     // 'status' will look like:
@@ -264,7 +277,7 @@ void TransmissionPoller::slot_get_read()
     if(reply)
     {
         auto& data = active_replies[reply];
-        data.buffer += reply->readAll();
+        data.reader->feed(reply->readAll());
     }
 }
 
@@ -274,18 +287,14 @@ void TransmissionPoller::slot_get_complete()
     if(reply && reply->error() == QNetworkReply::NoError)
     {
         auto& data = active_replies[reply];
-        data.buffer += reply->readAll();
+        data.reader->feed(reply->readAll());
+        ++response_count;
         process_reply(reply);
     }
 
-    if(reply)
-    {
-        if(active_replies.contains(reply))
-            active_replies.remove(reply);
-
-        reply->deleteLater();
-        reply = nullptr;
-    }
+    // the RequestEngine owns (and deletes) the reply
+    if(reply && active_replies.contains(reply))
+        active_replies.remove(reply);
 }
 
 void TransmissionPoller::slot_get_failed(QNetworkReply::NetworkError code)
@@ -305,19 +314,6 @@ void TransmissionPoller::slot_get_failed(QNetworkReply::NetworkError code)
     notify_interested_parties(-1, error_message);
 }
 
-void TransmissionPoller::slot_request_pump()
-{
-    if(active_replies.count())
-        return;
-
-    if(requests.count())
-    {
-        auto rd = requests.front();
-        requests.pop_front();
-        create_request(rd.url, rd.state, rd.data);
-    }
-}
-
 void TransmissionPoller::slot_poll()
 {
     // we only request updates if there are active watchers
@@ -328,7 +324,7 @@ void TransmissionPoller::slot_poll()
     {
         if(!data.party)
             continue;
-        enqueue_request(target.toString(), ReplyStates::GettingStatus);
+        enqueue_request_unique(target.toString(), ReplyStates::GettingStatus);
         break;
     }
 }
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <QtNetwork/QNetworkReply>
-#include <QtNetwork/QNetworkAccessManager>
 
 #include <QtCore/QTimer>
 #include <QtCore/QDateTime>
@@ -13,6 +12,10 @@
 
 #include "../../../specialize.h"
 
+#include "../requestengine.h"
+#include "../jsonreader.h"
+#include "../polltimer.h"
+
 #include "transmissionglobal.h"
 
 /// @class TransmissionPoller
@@ -37,19 +40,26 @@ class TRANSMISSIONSHARED_EXPORT TransmissionPoller : public QObject
 {
     Q_OBJECT
 public:
-    TransmissionPoller(const QUrl& target, int timeout, QObject* parent = nullptr);
+    TransmissionPoller(const QUrl& target, QObject* parent = nullptr);
     ~TransmissionPoller();
 
     // this filtering mechanism is used because Qt does not provide
-    // a canonical means of creating runtime, dynamic signals/slots
-    void    add_interest(int slot, QObject* me, int flags = 0);
+    // a canonical means of creating runtime, dynamic signals/slots.
+    // each party also sets the bounds (in seconds) within which
+    // the client is polled on its behalf.
+    void    add_interest(int slot, QObject* me, int poll_minimum, int poll_maximum, int flags = 0);
     void    remove_interest(int slot, QObject* me);
 
+    // how many poll responses have been received, and how many of those
+    // were unchanged since the last one (and so were not processed)
+    int     get_response_count()  const   { return response_count; }
+    int     get_unchanged_count() const   { return unchanged_count; }
+
 private slots:
     void    slot_get_read();
     void    slot_get_complete();
     void    slot_get_failed(QNetworkReply::NetworkError code);
-    void    slot_request_pump();
+    void    slot_request_started(int ticket, QNetworkReply* reply);
     void    slot_poll();
 
 private:    // typedefs and enums
@@ -87,7 +97,7 @@ private:    // classes
     struct ReplyData
     {
         ReplyStates state{ReplyStates::None};
-        QByteArray  buffer;
+        JsonReaderPointer reader;   // parses the reply as it arrives
         QStringList data;       // project + builder names and ids
     };
 
@@ -119,7 +129,7 @@ private:    // typedefs and enums
     SPECIALIZE_MAP(QString, ProjectData, Projects)      // "ProjectsMap"
     SPECIALIZE_MAP(QNetworkReply*, ReplyData, Reply)    // "ReplyMap"
     SPECIALIZE_MAP(QString, BuilderData, BuilderData)   // "BuilderDataMap"
-    SPECIALIZE_LIST(RequestData, Request)               // "RequestList"
+    SPECIALIZE_MAP(int /* ticket */, RequestData, Request)  // "RequestMap"
     SPECIALIZE_MAP(QString, bool, PendingRequests)      // "PendingRequestsMap"
     SPECIALIZE_LIST(InterestData, Interested)           // "InterestedList"
 
@@ -128,25 +138,26 @@ private:    // methods
     void            notify_interested_parties(int slot, const QString& message);
     void            enqueue_request(const QString& url_str, ReplyStates state, const QStringList& request_data = QStringList(), Priorities priority = Priorities::BackOfQueue);
     void            enqueue_request_unique(const QString& url_str, ReplyStates state, const QStringList& request_data = QStringList());
-    void            create_request(const QString& url_str, ReplyStates state, const QStringList& request_data = QStringList());
     void            process_reply(QNetworkReply *reply);
+    QStringList     reply_fields(ReplyStates state) const;
     void            process_client_status(const QJsonObject& status, const QStringList &status_data);
 
 private:    // data members
     QUrl        target;
 
-    QNetworkAccessManager*  QNAM{nullptr};
+    RequestEnginePointer    engine;
     ReplyMap    active_replies;
 
-    QTimer*     request_timer{nullptr};
-    QTimer*     poll_timer{nullptr};
-    int         poll_timeout{0};
+    PollTimer*  poll_timer{nullptr};
 
-    RequestList requests;
+    RequestMap  queued_requests;    // waiting on the RequestEngine, by ticket
     PendingRequestsMap  pending_requests;
 
     ProjectsMap projects;
 
+    int         response_count{0};
+    int         unchanged_count{0};
+
     InterestedList  interested_parties;
 };
 SPECIALIZE_SHAREDPTR(TransmissionPoller, Poller)        // "PollerPointer"
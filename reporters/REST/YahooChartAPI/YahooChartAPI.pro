@@ -61,11 +61,15 @@ UI_DIR = $$INTERMEDIATE_NAME/ui
 SOURCES += \
     chartapi.cpp \
     chartapifactory.cpp \
-    chartapipoller.cpp
+    chartapipoller.cpp \
+    ../requestengine.cpp \
+    ../polltimer.cpp
 
 HEADERS += \
         ../../interfaces/ireporter.h \
     chartapi.h \
     chartapi_global.h \
     chartapifactory.h \
-    chartapipoller.h
+    chartapipoller.h \
+    ../requestengine.h \
+    ../polltimer.h
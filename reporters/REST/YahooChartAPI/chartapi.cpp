@@ -3,6 +3,7 @@
 
 #include <QtCore/QFile>
 #include <QtCore/QJsonDocument>
+#include <QtCore/QDebug>
 #include <QtCore/QThread>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QCryptographicHash>
@@ -12,7 +13,8 @@
 #define ASSERT_UNUSED(cond) Q_ASSERT(cond); Q_UNUSED(cond)
 
 // 'lock-to-max-range', 'ensure-indicators-are-visible'
-const int ParametersVersion = 2;
+// 'idle-polling-limit'
+const int ParametersVersion = 3;
 
 YahooChartAPI::PollerMap YahooChartAPI::poller_map;
 
@@ -91,6 +93,15 @@ bool YahooChartAPI::RequiresUpgrade(int version, QStringList& parameters)
             parameters.insert(4, "");   // use the default
             parameters.insert(4, "");   // use the default
 
+            upgraded = true;
+        }
+        else if(version == 3)
+        {
+            // version 3 added
+            // - "Idle polling limit (sec):"
+
+            parameters.insert(6, "");   // use the default
+
             upgraded = true;
         }
     }
@@ -141,6 +152,16 @@ QStringList YahooChartAPI::Requires(int target_version) const
             definitions.insert(8, QString("check:%1").arg(lock_to_max_range ? "true" : "false"));
             definitions.insert(8, "Lock graph to largest volume range");
         }
+        else if(version == 3)
+        {
+            // version 3 added
+            // - "Idle polling limit (sec):"
+
+                                  // how many seconds between polls, at most, while
+                                  // the ticker isn't moving? (default: 900)
+            definitions.insert(12, QString("integer:%1").arg(poll_maximum));
+            definitions.insert(12, "Idle polling limit (sec):");
+        }
     }
 
     return definitions;
@@ -175,6 +196,10 @@ bool YahooChartAPI::SetRequirements(const QStringList& parameters)
         poll_timeout = poll_timeout < 60 ? 60 : poll_timeout;
     }
 
+    if(parameters.count() > Param::IdlePoll && !parameters[Param::IdlePoll].isEmpty())
+        poll_maximum = parameters[Param::IdlePoll].toInt();
+    poll_maximum = qMax(poll_timeout, poll_maximum);
+
     if(parameters.count() > Param::Graph && !parameters[Param::Template].isEmpty())
         display_graph = !parameters[Param::Graph].toLower().compare("true");
 
@@ -209,7 +234,7 @@ bool YahooChartAPI::CoverStory()
         chart_data.clear();
     chart_data = ChartDataPointer(new ChartData());
 
-    poller = acquire_poller(story, ticker, poll_timeout);
+    poller = acquire_poller(story, ticker);
     if(poller.isNull())
         return false;
 
@@ -220,7 +245,7 @@ bool YahooChartAPI::CoverStory()
     // signals and slots at runtime--we can't construct signals/slots
     // for specific project/builder combinations.
 
-    poller->add_interest(ticker, this);
+    poller->add_interest(ticker, this, poll_timeout, poll_maximum);
 
     return true;
 }
@@ -977,6 +1002,9 @@ void YahooChartAPI::ticker_update(const QString& status)
     chart_data->volume_max_str = QString::number(static_cast<double>(chart_data->current_high_high), 'f', 2);
     chart_data->volume_min_str = QString::number(static_cast<double>(chart_data->current_low_low), 'f', 2);
 
+    // displayed Headlines chart the history, too
+    emit signal_content_changed();
+
     if(lock_to_max_range)
     {
         auto font_color = QString("%1%2%3")
@@ -1073,6 +1101,7 @@ void YahooChartAPI::ticker_update(const QString& status)
                 chart_data->history.append(play_values.front());
                 play_values.pop_front();
 
+                emit signal_content_changed();
                 emit signal_new_data(status_str.toUtf8());
                 QCoreApplication::processEvents();
                 QThread::msleep(500);
@@ -1221,12 +1250,12 @@ QString YahooChartAPI::capitalize(const QString& str)
     return tmp;
 }
 
-PollerPointer YahooChartAPI::acquire_poller(const QUrl& story_, const QString& ticker, int timeout)
+PollerPointer YahooChartAPI::acquire_poller(const QUrl& story_, const QString& ticker)
 {
     if(!poller_map.contains(ticker))
     {
         PollerData pd;
-        pd.poller = PollerPointer(new YahooChartAPIPoller(TickerFormat::CSV, story_, ticker, timeout));
+        pd.poller = PollerPointer(new YahooChartAPIPoller(TickerFormat::CSV, story_, ticker));
         poller_map[ticker] = pd;
     }
 
@@ -1242,7 +1271,13 @@ void YahooChartAPI::release_poller(const QString &ticker)
 
     auto& pd = poller_map[ticker];
     if(--pd.reference_count == 0)
+    {
+#ifdef QT_DEBUG
+        qDebug() << "YahooChartAPIPoller:" << ticker << ":" << pd.poller->get_unchanged_count() << "of" << pd.poller->get_response_count() << "responses unchanged";
+#endif
+
         poller_map.remove(ticker);
+    }
 }
 
 void YahooChartAPI::slot_headline_sleep()
@@ -104,6 +104,7 @@ private:    // typedefs and enums
         Graph,
         MaxRange,   // v2
         Indicators, // v2
+        IdlePoll,   // v3
         Template,
         Max,
     } Param;
@@ -157,6 +158,7 @@ private:    // data members
     QString     ticker_alias;
 
     int         poll_timeout{60};
+    int         poll_maximum{900};
     int         last_timestamp{0};
     QByteArray  last_hash;
 
@@ -184,6 +186,6 @@ private:    // class-static data
     SPECIALIZE_MAP(QString, PollerData, Poller)         // "PollerMap"
 
     static  PollerMap       poller_map;
-    static  PollerPointer   acquire_poller(const QUrl &story, const QString &ticker, int timeout);
+    static  PollerPointer   acquire_poller(const QUrl &story, const QString &ticker);
     static  void            release_poller(const QString& ticker);
 };
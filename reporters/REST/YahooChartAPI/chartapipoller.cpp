@@ -3,11 +3,10 @@
 
 #define ASSERT_UNUSED(cond) Q_ASSERT(cond); Q_UNUSED(cond)
 
-YahooChartAPIPoller::YahooChartAPIPoller(TickerFormat format, const QUrl& target, const QString& ticker, int timeout, QObject *parent)
+YahooChartAPIPoller::YahooChartAPIPoller(TickerFormat format, const QUrl& target, const QString& ticker, QObject *parent)
     : QObject(parent),
       format(format),
-      ticker(ticker),
-      poll_timeout(timeout)
+      ticker(ticker)
 {
     // fix up the URL so we can add our own query elements
     auto story_scheme = target.scheme();
@@ -55,16 +54,11 @@ YahooChartAPIPoller::YahooChartAPIPoller(TickerFormat format, const QUrl& target
 
     this->target = QString("%1://%2/%3/").arg(story_scheme).arg(story_authority).arg(story_path.join("/"));
 
-    QNAM = new QNetworkAccessManager(this);
+    engine = RequestEngine::acquire();
+    connect(engine.data(), &RequestEngine::signal_request_started, this, &YahooChartAPIPoller::slot_request_started);
 
-    request_timer = new QTimer(this);
-    request_timer->setInterval(200);
-    connect(request_timer, &QTimer::timeout, this, &YahooChartAPIPoller::slot_request_pump);
-    request_timer->start();
-
-    poll_timer = new QTimer(this);
-    poll_timer->setInterval(poll_timeout * 1000);
-    connect(poll_timer, &QTimer::timeout, this, &YahooChartAPIPoller::slot_poll);
+    poll_timer = new PollTimer(this);
+    connect(poll_timer, &PollTimer::signal_poll, this, &YahooChartAPIPoller::slot_poll);
     poll_timer->start();
 
     // get the first update on our ticker symbol
@@ -75,13 +69,6 @@ YahooChartAPIPoller::YahooChartAPIPoller(TickerFormat format, const QUrl& target
 
 YahooChartAPIPoller::~YahooChartAPIPoller()
 {
-    if(request_timer)
-    {
-        request_timer->stop();
-        request_timer->deleteLater();
-        request_timer = nullptr;
-    }
-
     if(poll_timer)
     {
         poll_timer->stop();
@@ -89,14 +76,14 @@ YahooChartAPIPoller::~YahooChartAPIPoller()
         poll_timer = nullptr;
     }
 
-    if(QNAM)
+    if(engine)
     {
-        QNAM->deleteLater();
-        QNAM = nullptr;
+        engine->cancel_all(this);
+        engine.clear();
     }
 }
 
-void YahooChartAPIPoller::add_interest(const QString& ticker, QObject* me, int flags)
+void YahooChartAPIPoller::add_interest(const QString& ticker, QObject* me, int poll_minimum, int poll_maximum, int flags)
 {
     // make sure it's a YahooChartAPI instance
     auto chartapi = dynamic_cast<YahooChartAPI*>(me);
@@ -109,7 +96,13 @@ void YahooChartAPIPoller::add_interest(const QString& ticker, QObject* me, int f
     InterestData id{me, flags};
     interested_parties[ticker].append(id);
 
-    if(poll_timer->isActive())
+    poll_timer->set_bounds(me, poll_minimum, poll_maximum);
+
+    // the new party needs to hear the current state, even
+    // if it has not changed since the last poll
+    engine->invalidate(QUrl(target));
+
+    if(poll_timer->is_active())
     {
         poll_timer->start();    // reset it
         slot_poll();            // get a new update now
@@ -118,6 +111,8 @@ void YahooChartAPIPoller::add_interest(const QString& ticker, QObject* me, int f
 
 void YahooChartAPIPoller::remove_interest(const QString& ticker, QObject* me)
 {
+    poll_timer->clear_bounds(me);
+
     if(!interested_parties.contains(ticker))
         return;
 
@@ -236,11 +231,16 @@ void YahooChartAPIPoller::notify_interested_parties(TickerEvents event, const QS
 
 void YahooChartAPIPoller::enqueue_request(const QString& url_str, ReplyStates state, const QStringList& request_data, Priorities priority)
 {
+    QUrl url(url_str);
+
+    QNetworkRequest request(url);
+    request.setRawHeader(QByteArray("Content-type"), QByteArray("application/json"));
+    request.setRawHeader(QByteArray("Accept"), QByteArray("application/json"));
+
+    auto ticket = engine->get(request, this, priority == Priorities::FrontOfQueue ? RequestEngine::Priority::High : RequestEngine::Priority::Normal, true);
+
     RequestData rd{state, url_str, request_data};
-    if(priority == Priorities::BackOfQueue)
-        requests.push_back(rd);
-    else
-        requests.insert(0, rd);
+    queued_requests[ticket] = rd;
     pending_requests[rd.url] = true;
 }
 
@@ -251,15 +251,15 @@ void YahooChartAPIPoller::enqueue_request_unique(const QString& url_str, ReplySt
     enqueue_request(url_str, state, request_data);
 }
 
-void YahooChartAPIPoller::create_request(const QString& url_str, ReplyStates state, const QStringList& request_data)
+void YahooChartAPIPoller::slot_request_started(int ticket, QNetworkReply* reply)
 {
-    QUrl url(url_str);
+    // the engine serves every poller in the plug-in; only
+    // replies to our own requests are of interest here
+    if(!queued_requests.contains(ticket))
+        return;
 
-    QNetworkRequest request(url);
-    request.setRawHeader(QByteArray("Content-type"), QByteArray("application/json"));
-    request.setRawHeader(QByteArray("Accept"), QByteArray("application/json"));
+    auto rd = queued_requests.take(ticket);
 
-    auto reply = QNAM->get(request);
     auto connected = connect(reply, &QNetworkReply::readyRead, this, &YahooChartAPIPoller::slot_get_read);
     ASSERT_UNUSED(connected)
     connected = connect(reply, &QNetworkReply::finished, this, &YahooChartAPIPoller::slot_get_complete);
@@ -268,11 +268,10 @@ void YahooChartAPIPoller::create_request(const QString& url_str, ReplyStates sta
                         this, &YahooChartAPIPoller::slot_get_failed);
     ASSERT_UNUSED(connected)
 
-    ReplyData reply_data{state, QByteArray(), request_data};
+    ReplyData reply_data{rd.state, QByteArray(), rd.data};
     active_replies[reply] = reply_data;
 
-    if(pending_requests.contains(url_str))
-        pending_requests.remove(url_str);
+    pending_requests.remove(rd.url);
 }
 
 void YahooChartAPIPoller::process_reply(QNetworkReply *reply)
@@ -280,6 +279,17 @@ void YahooChartAPIPoller::process_reply(QNetworkReply *reply)
     auto& data = active_replies[reply];
     if(data.state == ReplyStates::GettingUpdate)
     {
+        // the ticker has not moved since the last poll
+        if(engine->is_unchanged(reply, data.buffer))
+        {
+            ++unchanged_count;
+            return;
+        }
+
+        // the ticker is moving (or the market has just opened),
+        // so keep polling at full speed
+        poll_timer->activity();
+
         if(format == TickerFormat::CSV)
             notify_interested_parties(TickerEvents::Update, ticker, QString(data.buffer));
         else if(format == TickerFormat::JSON)
@@ -314,17 +324,13 @@ void YahooChartAPIPoller::slot_get_complete()
     {
         auto& data = active_replies[reply];
         data.buffer += reply->readAll();
+        ++response_count;
         process_reply(reply);
     }
 
-    if(reply)
-    {
-        if(active_replies.contains(reply))
-            active_replies.remove(reply);
-
-        reply->deleteLater();
-        reply = nullptr;
-    }
+    // the RequestEngine owns (and deletes) the reply
+    if(reply && active_replies.contains(reply))
+        active_replies.remove(reply);
 }
 
 void YahooChartAPIPoller::slot_get_failed(QNetworkReply::NetworkError code)
@@ -344,19 +350,6 @@ void YahooChartAPIPoller::slot_get_failed(QNetworkReply::NetworkError code)
     notify_interested_parties(ticker, error_message);
 }
 
-void YahooChartAPIPoller::slot_request_pump()
-{
-    if(active_replies.count())
-        return;
-
-    if(requests.count())
-    {
-        auto rd = requests.front();
-        requests.pop_front();
-        create_request(rd.url, rd.state, rd.data);
-    }
-}
-
 void YahooChartAPIPoller::slot_poll()
 {
     // we only request updates for those builders that are actively being watched
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <QtNetwork/QNetworkReply>
-#include <QtNetwork/QNetworkAccessManager>
 
 #include <QtCore/QTimer>
 #include <QtCore/QDateTime>
@@ -15,6 +14,9 @@
 
 #include "../../../specialize.h"
 
+#include "../requestengine.h"
+#include "../polltimer.h"
+
 #include "chartapi_global.h"
 
 /// @class YahooChartAPIPoller
@@ -30,19 +32,26 @@ class YAHOOCHARTAPISHARED_EXPORT YahooChartAPIPoller : public QObject
 {
     Q_OBJECT
 public:
-    YahooChartAPIPoller(TickerFormat format, const QUrl& story, const QString& ticker, int timeout, QObject* parent = nullptr);
+    YahooChartAPIPoller(TickerFormat format, const QUrl& story, const QString& ticker, QObject* parent = nullptr);
     ~YahooChartAPIPoller();
 
     // this filtering mechanism is used because Qt does not provide
-    // a canonical means of creating runtime, dynamic signals/slots
-    void    add_interest(const QString& ticker, QObject* me, int flags = 0);
+    // a canonical means of creating runtime, dynamic signals/slots.
+    // each party also sets the bounds (in seconds) within which
+    // the ticker is polled on its behalf.
+    void    add_interest(const QString& ticker, QObject* me, int poll_minimum, int poll_maximum, int flags = 0);
     void    remove_interest(const QString& ticker, QObject* me);
 
+    // how many poll responses have been received, and how many of those
+    // were unchanged since the last one (and so were not processed)
+    int     get_response_count()  const   { return response_count; }
+    int     get_unchanged_count() const   { return unchanged_count; }
+
 private slots:
     void    slot_get_read();
     void    slot_get_complete();
     void    slot_get_failed(QNetworkReply::NetworkError code);
-    void    slot_request_pump();
+    void    slot_request_started(int ticket, QNetworkReply* reply);
     void    slot_poll();
 
 private:    // typedefs and enums
@@ -89,7 +98,7 @@ private:    // classes
 
 private:    // typedefs and enums
     SPECIALIZE_MAP(QNetworkReply*, ReplyData, Reply)    // "ReplyMap"
-    SPECIALIZE_LIST(RequestData, Request)               // "RequestList"
+    SPECIALIZE_MAP(int /* ticket */, RequestData, Request)  // "RequestMap"
     SPECIALIZE_MAP(QString, bool, PendingRequests)      // "PendingRequestsMap"
     SPECIALIZE_LIST(InterestData, Interested)           // "InterestedList"
     SPECIALIZE_MAP(QString, InterestedList, Interested) // "InterestedMap"
@@ -101,7 +110,6 @@ private:    // methods
     void            notify_interested_parties(const QString& ticker, const QString& message);
     void            enqueue_request(const QString& url_str, ReplyStates state, const QStringList& request_data = QStringList(), Priorities priority = Priorities::BackOfQueue);
     void            enqueue_request_unique(const QString& url_str, ReplyStates state, const QStringList& request_data = QStringList());
-    void            create_request(const QString& url_str, ReplyStates state, const QStringList& request_data = QStringList());
     void            process_reply(QNetworkReply *reply);
 
 private:    // data members
@@ -109,17 +117,18 @@ private:    // data members
     QString         target;
     QString         ticker;
 
-    QNetworkAccessManager*  QNAM{nullptr};
+    RequestEnginePointer    engine;
     ReplyMap        active_replies;
 
-    QTimer*         request_timer{nullptr};
-    QTimer*         poll_timer{nullptr};
-    int             poll_timeout{0};
+    PollTimer*      poll_timer{nullptr};
 
-    RequestList     requests;
+    RequestMap      queued_requests;    // waiting on the RequestEngine, by ticket
     PendingRequestsMap  pending_requests;
 
     InterestedMap   interested_parties;
+
+    int             response_count{0};
+    int             unchanged_count{0};
 };
 
 SPECIALIZE_SHAREDPTR(YahooChartAPIPoller, Poller)           // "PollerPointer"
@@ -0,0 +1,327 @@
+#include "jsonreader.h"
+
+JsonReader::JsonReader(const QStringList& selections_)
+{
+    // "buildTypes.buildType[].id" -> [ "buildTypes", "buildType", "[]", "id" ]
+    foreach(const QString& selection, selections_)
+    {
+        QStringList segments;
+        foreach(auto segment, selection.split(".", QString::SkipEmptyParts))
+        {
+            if(segment.endsWith("[]"))
+            {
+                segment.chop(2);
+                if(!segment.isEmpty())
+                    segments << segment;
+                segments << "[]";
+            }
+            else
+                segments << segment;
+        }
+
+        if(!segments.isEmpty())
+            selections << segments;
+    }
+}
+
+void JsonReader::feed(const QByteArray& data)
+{
+    hash.addData(data);
+
+    const auto* p = data.constData();
+    const auto size = data.size();
+
+    for(auto i = 0;i < size && !failed;++i)
+    {
+        auto ch = p[i];
+
+        if(lexing == Lexing::String)
+        {
+            if(escaped)
+                escaped = false;
+            else if(ch == '\\')
+                escaped = true;
+            else if(ch == '"')
+            {
+                lexing = Lexing::None;
+                string_token(token);
+                token.clear();
+                continue;
+            }
+
+            token += ch;
+            continue;
+        }
+
+        if(lexing == Lexing::Literal)
+        {
+            if((ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9') || ch == '-' || ch == '+' || ch == '.' || ch == 'E')
+            {
+                token += ch;
+                continue;
+            }
+
+            // the literal ends here; 'ch' is the next token
+            lexing = Lexing::None;
+            literal_token(token);
+            token.clear();
+            if(failed)
+                break;
+        }
+
+        switch(ch)
+        {
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                break;
+
+            case '{':
+                open_container(false);
+                break;
+            case '[':
+                open_container(true);
+                break;
+            case '}':
+                close_container(false);
+                break;
+            case ']':
+                close_container(true);
+                break;
+
+            case ':':
+                if(frames.isEmpty() || frames.last().is_array || !frames.last().have_key)
+                    failed = true;
+                break;
+            case ',':
+                if(frames.isEmpty())
+                    failed = true;
+                break;
+
+            case '"':
+                lexing = Lexing::String;
+                break;
+
+            default:
+                lexing = Lexing::Literal;
+                token += ch;
+                break;
+        }
+    }
+}
+
+bool JsonReader::is_valid() const
+{
+    return complete && !failed && frames.isEmpty() && lexing == Lexing::None;
+}
+
+QJsonObject JsonReader::object() const
+{
+    if(!is_valid())
+        return QJsonObject();
+    return root.toObject();
+}
+
+QByteArray JsonReader::digest() const
+{
+    return hash.result();
+}
+
+JsonReader::Modes JsonReader::next_mode() const
+{
+    if(frames.isEmpty())
+        return selections.isEmpty() ? Modes::Keep : Modes::Partial;
+
+    const auto& top = frames.last();
+    if(top.mode != Modes::Partial)
+        return top.mode;
+
+    auto candidate = path;
+    candidate << next_segment();
+
+    auto mode = Modes::Skip;
+    foreach(const auto& selection, selections)
+    {
+        auto common = qMin(selection.count(), candidate.count());
+        auto matched{true};
+        for(auto i = 0;i < common && matched;++i)
+            matched = (selection[i] == candidate[i]);
+
+        if(!matched)
+            continue;
+
+        if(selection.count() <= candidate.count())
+            return Modes::Keep;     // at or beneath a selection
+        mode = Modes::Partial;      // on the way to a selection
+    }
+
+    return mode;
+}
+
+QString JsonReader::next_segment() const
+{
+    const auto& top = frames.last();
+    return top.is_array ? QString("[]") : top.key;
+}
+
+void JsonReader::open_container(bool is_array)
+{
+    if(complete || (!frames.isEmpty() && !frames.last().is_array && !frames.last().have_key))
+    {
+        failed = true;
+        return;
+    }
+
+    Frame frame;
+    frame.is_array = is_array;
+    frame.mode = next_mode();
+
+    if(!frames.isEmpty())
+        path << next_segment();
+
+    frames.append(frame);
+}
+
+void JsonReader::close_container(bool is_array)
+{
+    if(frames.isEmpty() || frames.last().is_array != is_array || (!is_array && frames.last().have_key))
+    {
+        failed = true;
+        return;
+    }
+
+    auto frame = frames.takeLast();
+    if(!frames.isEmpty())
+        path.removeLast();
+
+    if(frame.mode == Modes::Skip)
+        add_value(QJsonValue(), frame.mode);
+    else if(frame.is_array)
+        add_value(frame.array, frame.mode);
+    else
+        add_value(frame.object, frame.mode);
+}
+
+void JsonReader::string_token(const QByteArray& token)
+{
+    if(!frames.isEmpty() && !frames.last().is_array && !frames.last().have_key)
+    {
+        // this is a member name; there's no need to decode
+        // it if nothing beneath this object is being kept
+        auto& top = frames.last();
+        top.key = (top.mode == Modes::Skip) ? QString() : decode_string(token);
+        top.have_key = true;
+        return;
+    }
+
+    auto mode = next_mode();
+    add_value(mode == Modes::Skip ? QJsonValue() : QJsonValue(decode_string(token)), mode);
+}
+
+void JsonReader::literal_token(const QByteArray& token)
+{
+    auto mode = next_mode();
+
+    QJsonValue value;
+    if(token == "true")
+        value = true;
+    else if(token == "false")
+        value = false;
+    else if(token != "null")
+    {
+        auto ok{false};
+        auto number = token.toDouble(&ok);
+        if(!ok)
+        {
+            failed = true;
+            return;
+        }
+
+        value = number;
+    }
+
+    add_value(value, mode);
+}
+
+void JsonReader::add_value(const QJsonValue& value, Modes mode)
+{
+    if(frames.isEmpty())
+    {
+        if(complete)
+            failed = true;
+        root = value;
+        complete = true;
+        return;
+    }
+
+    auto& top = frames.last();
+    if(!top.is_array && !top.have_key)
+    {
+        failed = true;
+        return;
+    }
+
+    if(mode != Modes::Skip)
+    {
+        if(top.is_array)
+            top.array.append(value);
+        else
+            top.object.insert(top.key, value);
+    }
+
+    top.have_key = false;
+}
+
+QString JsonReader::decode_string(const QByteArray& token) const
+{
+    if(!token.contains('\\'))
+        return QString::fromUtf8(token);
+
+    QString result;
+
+    const auto* p = token.constData();
+    const auto size = token.size();
+
+    auto start{0};
+    for(auto i = 0;i < size;++i)
+    {
+        if(p[i] != '\\')
+            continue;
+
+        result += QString::fromUtf8(p + start, i - start);
+        if(++i == size)
+            break;
+
+        switch(p[i])
+        {
+            case 'b':   result += QChar('\b'); break;
+            case 'f':   result += QChar('\f'); break;
+            case 'n':   result += QChar('\n'); break;
+            case 'r':   result += QChar('\r'); break;
+            case 't':   result += QChar('\t'); break;
+            case 'u':
+                if(i + 4 < size)
+                {
+                    // surrogate pairs arrive as two escapes, and
+                    // simply become two UTF-16 code units
+                    auto ok{false};
+                    auto code = token.mid(i + 1, 4).toUShort(&ok, 16);
+                    if(ok)
+                        result += QChar(code);
+                    i += 4;
+                }
+                break;
+            default:    // '"', '\\' and '/'
+                result += QChar(p[i]);
+                break;
+        }
+
+        start = i + 1;
+    }
+
+    if(start < size)
+        result += QString::fromUtf8(p + start, size - start);
+
+    return result;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QStringList>
+#include <QtCore/QCryptographicHash>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+#include <QtCore/QJsonArray>
+
+#include "../../specialize.h"
+
+/// @class JsonReader
+/// @brief Incremental JSON reader for poller replies
+///
+/// The pollers used to collect every chunk of a reply into a buffer, and
+/// then build a complete QJsonDocument from it, even though they only
+/// read a handful of fields.  A JsonReader is instead fed each chunk as
+/// it arrives, and parses it on the spot, keeping only the values found
+/// at the paths it was asked to select.  The raw reply is never held in
+/// memory, and the object the poller receives holds nothing it does not
+/// use.
+///
+/// Paths are dot-separated member names, where "[]" stands for every
+/// element of an array, e.g.:
+///
+///     "count", "project[].id", "buildTypes.buildType[].name"
+///
+/// A selected path keeps the value there in its entirety.  A reader
+/// with no selections keeps the whole document.
+///
+/// The reader also digests everything it is fed, so the poller can ask
+/// the RequestEngine whether the reply has changed without keeping it.
+
+class JsonReader
+{
+public:
+    explicit JsonReader(const QStringList& selections = QStringList());
+
+    void        feed(const QByteArray& data);
+
+    /*!
+      Returns true once a complete, well-formed document has been read,
+      and nothing but whitespace has followed it.
+     */
+    bool        is_valid() const;
+
+    /*!
+      Returns the selected parts of the document, if it was an object and
+      is_valid().  Otherwise, the object is empty.
+     */
+    QJsonObject object() const;
+
+    /*!
+      Returns the MD5 digest of everything fed to the reader.
+     */
+    QByteArray  digest() const;
+
+private:    // typedefs and enums
+    enum class Modes
+    {
+        Skip,       // not selected; read, but not kept
+        Partial,    // leads to a selection; kept, but only in part
+        Keep,       // selected; kept in its entirety
+    };
+
+    enum class Lexing
+    {
+        None,
+        String,
+        Literal,
+    };
+
+    struct Frame
+    {
+        bool        is_array{false};
+        Modes       mode{Modes::Skip};
+        QJsonObject object;
+        QJsonArray  array;
+        QString     key;            // member awaiting its value
+        bool        have_key{false};
+    };
+
+    SPECIALIZE_LIST(QStringList, Path)                  // "PathList"
+    SPECIALIZE_VECTOR(Frame, Frame)                     // "FrameVector"
+
+private:    // methods
+    void        open_container(bool is_array);
+    void        close_container(bool is_array);
+    void        string_token(const QByteArray& token);
+    void        literal_token(const QByteArray& token);
+    void        add_value(const QJsonValue& value, Modes mode);
+    Modes       next_mode() const;
+    QString     next_segment() const;
+    QString     decode_string(const QByteArray& token) const;
+
+private:    // data members
+    PathList    selections;
+    QStringList path;               // to the innermost open container
+
+    FrameVector frames;
+    QJsonValue  root;
+    bool        complete{false};
+    bool        failed{false};
+
+    Lexing      lexing{Lexing::None};
+    QByteArray  token;
+    bool        escaped{false};
+
+    QCryptographicHash  hash{QCryptographicHash::Md5};
+};
+
+SPECIALIZE_SHAREDPTR(JsonReader, JsonReader)            // "JsonReaderPointer"
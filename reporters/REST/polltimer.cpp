@@ -0,0 +1,87 @@
+#include "polltimer.h"
+
+PollTimer::PollTimer(QObject* parent)
+    : QObject(parent)
+{
+    timer = new QTimer(this);
+    timer->setSingleShot(true);
+    connect(timer, &QTimer::timeout, this, &PollTimer::slot_timeout);
+}
+
+void PollTimer::set_bounds(QObject* party, int minimum_, int maximum_)
+{
+    minimum_ = qMax(1, minimum_);
+    bounds[party] = BoundsPair(minimum_, qMax(minimum_, maximum_));
+    update_bounds();
+}
+
+void PollTimer::clear_bounds(QObject* party)
+{
+    bounds.remove(party);
+    update_bounds();
+}
+
+void PollTimer::start()
+{
+    interval = minimum;
+    active = false;
+    timer->start(interval * 1000);
+}
+
+void PollTimer::stop()
+{
+    timer->stop();
+}
+
+bool PollTimer::is_active() const
+{
+    return timer->isActive();
+}
+
+void PollTimer::activity()
+{
+    active = true;
+    if(interval == minimum)
+        return;
+
+    interval = minimum;
+    reschedule();
+}
+
+void PollTimer::slot_timeout()
+{
+    // nothing happened during the last interval, so wait
+    // twice as long for the next poll
+    if(!active)
+        interval = qMin(interval * 2, maximum);
+    active = false;
+
+    timer->start(interval * 1000);
+
+    emit signal_poll();
+}
+
+void PollTimer::update_bounds()
+{
+    if(bounds.isEmpty())
+        return;     // keep polling as before until someone says otherwise
+
+    minimum = bounds.begin().value().first;
+    maximum = bounds.begin().value().second;
+    for(auto iter = bounds.begin();iter != bounds.end();++iter)
+    {
+        minimum = qMin(minimum, iter.value().first);
+        maximum = qMin(maximum, iter.value().second);
+    }
+    maximum = qMax(minimum, maximum);
+
+    interval = qBound(minimum, interval, maximum);
+    reschedule();
+}
+
+void PollTimer::reschedule()
+{
+    // don't wait out a longer interval than the one now in effect
+    if(timer->isActive() && timer->remainingTime() > interval * 1000)
+        timer->start(interval * 1000);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtCore/QMap>
+#include <QtCore/QPair>
+
+#include "../../specialize.h"
+
+/// @class PollTimer
+/// @brief Adaptive poll scheduling for the REST pollers
+///
+/// A poller used to poll its endpoint at a fixed rate, whether or not
+/// anything was happening there.  A PollTimer instead moves its interval
+/// between a minimum and a maximum (in seconds) based on what the poller
+/// reports seeing.  While the poller reports activity (builds running,
+/// torrents moving, a reply that differs from the last one), polls come
+/// at the minimum interval.  Each poll that passes without activity
+/// doubles the interval, up to the maximum, and the first activity seen
+/// brings it straight back down to the minimum.
+///
+/// Each interested party brings its own bounds.  A poller shared by
+/// several parties polls within the tightest of them: the smallest
+/// minimum, and the smallest maximum.
+
+class PollTimer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit PollTimer(QObject* parent = nullptr);
+
+    /*!
+      Records the poll bounds required by an interested party, replacing
+      any it set before.
+
+      \param party The party the bounds belong to.
+      \param minimum The fastest polling interval, in seconds (minimum 1).
+      \param maximum The slowest polling interval, in seconds.  A value below the minimum is raised to it.
+     */
+    void    set_bounds(QObject* party, int minimum, int maximum);
+    void    clear_bounds(QObject* party);
+
+    /*!
+      Starts (or restarts) polling at the minimum interval.  signal_poll()
+      is emitted each time the interval elapses.
+     */
+    void    start();
+    void    stop();
+    bool    is_active() const;
+
+    /*!
+      Called by the poller whenever it sees something happening at its
+      endpoint.  The current wait is cut short to the minimum interval,
+      and the next poll does not back off.
+     */
+    void    activity();
+
+    // the current polling interval, in seconds
+    int     get_interval() const      { return interval; }
+
+signals:
+    void    signal_poll();
+
+private slots:
+    void    slot_timeout();
+
+private:    // typedefs and enums
+    SPECIALIZE_PAIR(int, int, Bounds)                   // "BoundsPair"
+    SPECIALIZE_MAP(QObject*, BoundsPair, Bounds)        // "BoundsMap"
+
+private:    // methods
+    void    update_bounds();
+    void    reschedule();
+
+private:    // data members
+    QTimer*     timer{nullptr};
+
+    BoundsMap   bounds;
+    int         minimum{60};
+    int         maximum{60};
+    int         interval{60};
+
+    bool        active{false};      // activity seen since the last poll
+};
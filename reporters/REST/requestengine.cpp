@@ -0,0 +1,321 @@
+#include <QtCore/QCryptographicHash>
+
+#include "requestengine.h"
+
+// how many requests may be in flight to a single host when the
+// host has not been given a limit of its own
+const int DefaultHostLimit = 4;
+
+// how many URLs the response cache remembers before the
+// least recently used is forgotten
+const int MaxCacheEntries = 128;
+
+// marks the requests the engine issued as conditional, so their
+// replies (and only theirs) are recorded in the response cache
+const QNetworkRequest::Attribute ConditionalAttribute = QNetworkRequest::User;
+
+RequestEngineWeakPointer RequestEngine::shared_engine;
+
+RequestEngine::RequestEngine(QObject* parent)
+    : QObject(parent)
+{
+    QNAM = new QNetworkAccessManager(this);
+}
+
+RequestEngine::~RequestEngine()
+{
+    // replies belong to the QNAM, and go with it
+    foreach(auto reply, active_replies.keys())
+    {
+        reply->disconnect(this);
+        reply->abort();
+    }
+
+    active_replies.clear();
+}
+
+RequestEnginePointer RequestEngine::acquire()
+{
+    auto engine = shared_engine.toStrongRef();
+    if(engine.isNull())
+    {
+        engine = RequestEnginePointer(new RequestEngine());
+        shared_engine = engine;
+    }
+
+    return engine;
+}
+
+void RequestEngine::set_host_limit(const QString& host, int limit)
+{
+    host_limits[host.toLower()] = qMax(1, limit);
+    schedule_pump();
+}
+
+int RequestEngine::get(const QNetworkRequest& request, QObject* owner, Priority priority, bool conditional)
+{
+    Request r;
+    r.ticket = next_ticket++;
+    r.owner = owner;
+    r.request = request;
+    r.conditional = conditional;
+
+    auto& host = hosts[request.url().host().toLower()];
+    host.lanes[static_cast<int>(priority)].enqueue(r);
+
+    schedule_pump();
+
+    return r.ticket;
+}
+
+bool RequestEngine::cancel(int ticket)
+{
+    for(auto iter = hosts.begin();iter != hosts.end();++iter)
+    {
+        for(auto lane = 0;lane < static_cast<int>(Priority::Count);++lane)
+        {
+            auto& queue = iter.value().lanes[lane];
+            for(auto i = 0;i < queue.length();++i)
+            {
+                if(queue[i].ticket == ticket)
+                {
+                    queue.removeAt(i);
+                    schedule_pump();    // the host may be idle now
+                    return true;
+                }
+            }
+        }
+    }
+
+    for(auto iter = active_replies.begin();iter != active_replies.end();++iter)
+    {
+        if(iter.value().ticket == ticket)
+        {
+            // the slot is freed when the reply finishes
+            iter.key()->abort();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void RequestEngine::cancel_all(QObject* owner)
+{
+    for(auto iter = hosts.begin();iter != hosts.end();++iter)
+    {
+        for(auto lane = 0;lane < static_cast<int>(Priority::Count);++lane)
+        {
+            auto& queue = iter.value().lanes[lane];
+            for(auto i = queue.length() - 1;i >= 0;--i)
+            {
+                if(queue[i].owner == owner)
+                    queue.removeAt(i);
+            }
+        }
+    }
+
+    QList<QNetworkReply*> aborting;
+    for(auto iter = active_replies.begin();iter != active_replies.end();++iter)
+    {
+        if(iter.value().owner == owner)
+            aborting.append(iter.key());
+    }
+
+    auto iter = cache.begin();
+    while(iter != cache.end())
+    {
+        if(iter.value().owner == owner)
+            iter = cache.erase(iter);
+        else
+            ++iter;
+    }
+
+    // the owner is usually going away, so it hears nothing further
+    // from these.  abort() emits finished() synchronously, which edits
+    // 'active_replies' (and frees the slot).
+    foreach(auto reply, aborting)
+    {
+        reply->disconnect(owner);
+        reply->abort();
+    }
+
+    // hosts whose queues were emptied are let go on the next pump
+    schedule_pump();
+}
+
+void RequestEngine::schedule_pump()
+{
+    if(pump_scheduled)
+        return;
+
+    // issue from the event loop, so a poller is never handed a new
+    // reply while it is still in the middle of submitting requests
+    pump_scheduled = true;
+    QMetaObject::invokeMethod(this, "slot_pump", Qt::QueuedConnection);
+}
+
+bool RequestEngine::HostData::is_idle() const
+{
+    if(in_flight)
+        return false;
+
+    for(auto lane = 0;lane < static_cast<int>(Priority::Count);++lane)
+    {
+        if(!lanes[lane].isEmpty())
+            return false;
+    }
+
+    return true;
+}
+
+void RequestEngine::slot_pump()
+{
+    pump_scheduled = false;
+
+    // forget hosts that nobody is talking to any more (a poller can
+    // cancel while it is being handed a reply, so this is never done
+    // while requests are being issued below)
+    auto idle = hosts.begin();
+    while(idle != hosts.end())
+    {
+        if(idle.value().is_idle())
+            idle = hosts.erase(idle);
+        else
+            ++idle;
+    }
+
+    for(auto iter = hosts.begin();iter != hosts.end();++iter)
+    {
+        auto& host = iter.value();
+        auto limit = host_limits.value(iter.key(), DefaultHostLimit);
+
+        for(auto lane = 0;lane < static_cast<int>(Priority::Count) && host.in_flight < limit;++lane)
+        {
+            auto& queue = host.lanes[lane];
+            while(!queue.isEmpty() && host.in_flight < limit)
+            {
+                auto r = queue.dequeue();
+
+                // make the request conditional if we have seen this URL before
+                if(r.conditional)
+                {
+                    r.request.setAttribute(ConditionalAttribute, true);
+
+                    auto& cd = cache_entry(cache_key(r.request.url()));
+                    cd.owner = r.owner;
+                    if(!cd.etag.isEmpty() && !r.request.hasRawHeader("If-None-Match"))
+                        r.request.setRawHeader(QByteArray("If-None-Match"), cd.etag);
+                    if(!cd.last_modified.isEmpty() && !r.request.hasRawHeader("If-Modified-Since"))
+                        r.request.setRawHeader(QByteArray("If-Modified-Since"), cd.last_modified);
+                }
+
+                auto reply = QNAM->get(r.request);
+                connect(reply, &QNetworkReply::finished, this, &RequestEngine::slot_reply_finished);
+
+                ActiveData ad;
+                ad.ticket = r.ticket;
+                ad.owner = r.owner;
+                ad.host = iter.key();
+                active_replies[reply] = ad;
+
+                ++host.in_flight;
+
+                emit signal_request_started(r.ticket, reply);
+            }
+        }
+    }
+}
+
+void RequestEngine::slot_reply_finished()
+{
+    auto reply = qobject_cast<QNetworkReply*>(sender());
+    if(!reply || !active_replies.contains(reply))
+        return;
+
+    auto ad = active_replies.take(reply);
+    if(hosts.contains(ad.host))
+        --hosts[ad.host].in_flight;
+
+    // the poller's own finished() handler may still be pending
+    // in this emission, so the reply cannot be deleted yet
+    reply->deleteLater();
+
+    // a slot has freed up for this host
+    schedule_pump();
+}
+
+QString RequestEngine::cache_key(const QUrl& url) const
+{
+    // credentials are not part of what is being requested
+    return url.toString(QUrl::RemoveUserInfo);
+}
+
+RequestEngine::CacheData& RequestEngine::cache_entry(const QString& key)
+{
+    if(!cache.contains(key) && cache.count() >= MaxCacheEntries)
+    {
+        auto oldest = cache.begin();
+        for(auto iter = cache.begin();iter != cache.end();++iter)
+        {
+            if(iter.value().last_used < oldest.value().last_used)
+                oldest = iter;
+        }
+        cache.erase(oldest);
+    }
+
+    auto& cd = cache[key];
+    cd.last_used = ++cache_clock;
+    return cd;
+}
+
+bool RequestEngine::is_unchanged(QNetworkReply* reply, const QByteArray& body)
+{
+    return is_digest_unchanged(reply, QCryptographicHash::hash(body, QCryptographicHash::Md5));
+}
+
+bool RequestEngine::is_digest_unchanged(QNetworkReply* reply, const QByteArray& digest)
+{
+    // only replies to conditional requests are cached, and the entry
+    // was created (with its owner) when the request was issued
+    if(!reply->request().attribute(ConditionalAttribute).toBool())
+        return false;
+
+    auto iter = cache.find(cache_key(reply->request().url()));
+    if(iter == cache.end())
+        return false;   // forgotten (or invalidated) while in flight
+
+    auto& cd = iter.value();
+    cd.last_used = ++cache_clock;
+
+    auto status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if(status == 304)
+        return true;
+
+    // an error body says nothing about the resource, so it must not
+    // replace the validators or digest of the last good response
+    if(reply->error() != QNetworkReply::NoError || status < 200 || status >= 300)
+        return false;
+
+    auto unchanged = !cd.digest.isEmpty() && cd.digest == digest;
+
+    cd.etag = reply->rawHeader("ETag");
+    cd.last_modified = reply->rawHeader("Last-Modified");
+    cd.digest = digest;
+
+    return unchanged;
+}
+
+void RequestEngine::invalidate(const QUrl& url)
+{
+    auto prefix = cache_key(url);
+
+    auto iter = cache.begin();
+    while(iter != cache.end())
+    {
+        if(iter.key().startsWith(prefix))
+            iter = cache.erase(iter);
+        else
+            ++iter;
+    }
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <QtNetwork/QNetworkReply>
+#include <QtNetwork/QNetworkRequest>
+#include <QtNetwork/QNetworkAccessManager>
+
+#include <QtCore/QObject>
+#include <QtCore/QQueue>
+
+#include "../../specialize.h"
+
+class RequestEngine;
+SPECIALIZE_SHAREDPTR(RequestEngine, RequestEngine)          // "RequestEnginePointer"
+SPECIALIZE_WEAKPTR(RequestEngine, RequestEngine)            // "RequestEngineWeakPointer"
+
+/// @class RequestEngine
+/// @brief Shared HTTP request engine for the REST pollers
+///
+/// Every poller in a REST Reporter plug-in submits its GET requests here
+/// instead of running its own request timer.  Requests are queued per
+/// host, in priority lanes, and each host may have a configurable number
+/// of requests in flight at once.  A queued request is issued as soon as
+/// a slot for its host frees up.
+///
+/// When a request is issued, signal_request_started() delivers the
+/// QNetworkReply to the poller that submitted it (identified by the
+/// ticket get() returned).  The poller connects to the reply's signals
+/// as usual, but the engine owns the reply and deletes it once it has
+/// finished.
+///
+/// The engine also remembers the ETag and Last-Modified validators, and
+/// a digest of the body, of recent responses to requests submitted as
+/// conditional.  Repeated requests for the same URL carry those
+/// validators, and is_unchanged() lets a poller skip parsing (and
+/// notifying) entirely when the server answers 304 Not Modified, or
+/// returns exactly what it returned last time.  Only requests whose
+/// replies the poller can do without should be conditional: a 304 has
+/// no body.
+
+class RequestEngine : public QObject
+{
+    Q_OBJECT
+public:
+    enum class Priority
+    {
+        High,       // e.g., final results the user is waiting on
+        Normal,
+        Low,
+
+        Count
+    };
+
+    ~RequestEngine();
+
+    /*!
+      Returns the engine shared by all pollers in this plug-in, creating
+      it if needed.  The engine lives as long as any poller holds it.
+     */
+    static RequestEnginePointer acquire();
+
+    /*!
+      Sets how many requests may be in flight at once to the indicated
+      host.  Hosts that have not been configured use DefaultHostLimit.
+
+      \param host The host name, as reported by QUrl::host().
+      \param limit The maximum number of concurrent requests (minimum 1).
+     */
+    void    set_host_limit(const QString& host, int limit);
+
+    /*!
+      Queues a GET request.  The returned ticket identifies the request
+      in signal_request_started() and cancel().
+
+      \param request The fully-formed network request.
+      \param owner The object submitting the request, for cancel_all().
+      \param priority The lane in which the request waits for its host.
+      \param conditional Whether the request may be answered with 304 Not Modified.
+      \return A ticket (greater than zero) for the request.
+     */
+    int     get(const QNetworkRequest& request, QObject* owner, Priority priority = Priority::Normal, bool conditional = false);
+
+    /*!
+      Cancels a request.  A queued request is discarded; one in flight is
+      aborted, and its reply will finish with OperationCanceledError.
+      cancel_all() also forgets the owner's cached responses.
+
+      \return true if the ticket was queued or in flight.
+     */
+    bool    cancel(int ticket);
+    void    cancel_all(QObject* owner);
+
+    /*!
+      Called by a poller when a reply has finished, with the complete
+      body it received.  If the request was submitted as conditional and
+      the server answered with success (2xx), records the response in the
+      cache.  Reports whether it is the same as the last response for that
+      URL; replies to other requests, and error replies, are always
+      reported as changed, and leave the cache as it was.
+
+      \param reply The finished reply (still owned by the engine).
+      \param body The body the poller read from the reply.
+      \return true if the server answered 304, or the body is unchanged.
+     */
+    bool    is_unchanged(QNetworkReply* reply, const QByteArray& body);
+
+    /*!
+      As is_unchanged(), for pollers that do not keep the body, but
+      digest it (with MD5) as it arrives.
+     */
+    bool    is_digest_unchanged(QNetworkReply* reply, const QByteArray& digest);
+
+    /*!
+      Forgets the cached responses for the indicated URL, and any beneath
+      it, so the next response for each is reported as changed.  Pollers
+      use this when a new party needs to hear the current state.
+     */
+    void    invalidate(const QUrl& url);
+
+signals:
+    void    signal_request_started(int ticket, QNetworkReply* reply);
+
+private slots:
+    void    slot_pump();
+    void    slot_reply_finished();
+
+private:    // typedefs and enums
+    struct Request
+    {
+        int             ticket{0};
+        QObject*        owner{nullptr};
+        QNetworkRequest request;
+        bool            conditional{false};
+    };
+    SPECIALIZE_QUEUE(Request, Request)                  // "RequestQueue"
+
+    struct HostData
+    {
+        int             in_flight{0};
+        RequestQueue    lanes[static_cast<int>(Priority::Count)];
+
+        bool            is_idle() const;
+    };
+
+    struct ActiveData
+    {
+        int             ticket{0};
+        QObject*        owner{nullptr};
+        QString         host;
+    };
+
+    struct CacheData
+    {
+        QObject*        owner{nullptr};
+        QByteArray      etag;
+        QByteArray      last_modified;
+        QByteArray      digest;             // of the last body received
+        quint64         last_used{0};
+    };
+
+    SPECIALIZE_MAP(QString, HostData, Host)             // "HostMap"
+    SPECIALIZE_MAP(QString, int, Limit)                 // "LimitMap"
+    SPECIALIZE_MAP(QNetworkReply*, ActiveData, Active)  // "ActiveMap"
+    SPECIALIZE_MAP(QString, CacheData, Cache)           // "CacheMap"
+
+private:    // methods
+    explicit RequestEngine(QObject* parent = nullptr);
+
+    void        schedule_pump();
+    QString     cache_key(const QUrl& url) const;
+    CacheData&  cache_entry(const QString& key);
+
+private:    // class-static data
+    static RequestEngineWeakPointer shared_engine;
+
+private:    // data members
+    QNetworkAccessManager*  QNAM{nullptr};
+
+    HostMap     hosts;          // only hosts with requests queued or in flight
+    LimitMap    host_limits;
+    ActiveMap   active_replies;
+    CacheMap    cache;
+    quint64     cache_clock{0};
+
+    int         next_ticket{1};
+    bool        pump_scheduled{false};
+};
@@ -322,6 +322,16 @@ signals:
       a shelved Story has become interesting enough to cover again.
      */
     void        signal_unshelve_story();
+
+    /*!
+      Headlines keep a rendered image of their content, and only call
+      ReporterDraw() again when they are told it has changed.  This signal
+      should be emitted whenever ReporterDraw() would draw something
+      different for Headlines that are already displayed.  Until it has
+      been emitted once, the Reporter's Headlines call ReporterDraw() on
+      every paint (see reporters/README.md).
+     */
+    void        signal_content_changed();
 };
 
 /// @class IReporterFactory
@@ -0,0 +1,42 @@
+#include "reportsplitter.h"
+
+ReportSplitter::ReportSplitter(const QByteArray& data, int limit)
+    : data(data),
+      separator(data.contains("<br>") ? "<br>" : "\n"),
+      limit(limit)
+{
+}
+
+bool ReportSplitter::next(QString& headline)
+{
+    auto run_start{-1};
+    auto current_limit{0};
+    while(!done)
+    {
+        auto line_end = data.indexOf(separator, line_start);
+        auto last_line = (line_end == -1);
+        if(last_line)
+            line_end = data.length();
+
+        if(run_start == -1 && line_end > line_start)
+            run_start = line_start;
+
+        done = last_line;
+        if(!done)
+            line_start = line_end + separator.length();
+
+        if(++current_limit == limit || done)
+        {
+            if(run_start != -1)
+            {
+                headline = QString::fromUtf8(data.constData() + run_start, line_end - run_start);
+                return true;
+            }
+
+            // a run of empty lines files nothing
+            current_limit = 0;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+/// @class ReportSplitter
+/// @brief Divides a report into Headlines of a limited number of lines
+///
+/// When a Story limits its content, the Producer files each run of
+/// 'limit' lines of a report as its own Headline.  Lines are separated by
+/// "<br>" if the report contains any, otherwise by newlines.
+///
+/// Each Headline is a contiguous run of lines from the original report,
+/// so rather than splitting the report into lines and gluing them back
+/// together, the splitter locates where each run begins and ends in the
+/// (UTF-8) buffer, and converts only that span.  The separators are ASCII,
+/// so they can never match in the middle of a multi-byte character.
+///
+/// Empty lines at the start of a run are not included in its Headline,
+/// and a run of nothing but empty lines produces no Headline at all.  A
+/// limit of zero (or less) files the whole report as one Headline.
+
+class ReportSplitter
+{
+public:
+    /*!
+      \param data The report, as received from the Reporter.  It must
+                  outlive the splitter.
+      \param limit The number of lines in each Headline.
+     */
+    ReportSplitter(const QByteArray& data, int limit);
+
+    /*!
+      Retrieves the next Headline from the report.
+
+      \param headline Receives the text of the Headline.
+      \return false once the report has been exhausted.
+     */
+    bool    next(QString& headline);
+
+private:    // data members
+    const QByteArray&   data;
+    QByteArray          separator;
+    int                 limit{0};
+
+    int                 line_start{0};
+    bool                done{false};
+};
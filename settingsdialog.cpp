@@ -64,6 +64,16 @@ void SettingsDialog::set_autostart_coverage(bool autostart)
     ui->check_AutoStartCoverage->setChecked(autostart);
 }
 
+void SettingsDialog::set_compositing(bool composite)
+{
+    ui->check_UseCompositor->setChecked(composite);
+}
+
+void SettingsDialog::set_lane_manager(LaneManagerPointer lane_manager)
+{
+    this->lane_manager = lane_manager;
+}
+
 void SettingsDialog::set_font(const QFont& font)
 {
     QSignalBlocker blocker(ui->combo_FontFamily);
@@ -162,6 +172,11 @@ bool SettingsDialog::get_autostart_coverage() const
     return ui->check_AutoStartCoverage->isChecked();
 }
 
+bool SettingsDialog::get_compositing() const
+{
+    return ui->check_UseCompositor->isChecked();
+}
+
 QFont SettingsDialog::get_font()
 {
     auto f = ui->combo_FontFamily->currentFont();
@@ -381,6 +396,7 @@ void SettingsDialog::slot_edit_series()
     // stop this series before we edit its settings
     QBitArray active(selections[0]->childCount());
 
+    lane_manager->begin();
     for(auto j = 0;j < selections[0]->childCount();++j)
     {
         auto story_item = selections[0]->child(j);
@@ -393,6 +409,7 @@ void SettingsDialog::slot_edit_series()
                 story_item->setIcon(0, QIcon(":/images/NotCovering.png"));
         }
     }
+    lane_manager->commit();
 
     EditSeriesDialog dlg(this);
     dlg.set_compact_mode(si->compact_mode, si->compact_compression);
@@ -415,6 +432,7 @@ void SettingsDialog::slot_edit_series()
     }
 
     // restart, as indicated
+    lane_manager->begin();
     for(auto j = 0;j < selections[0]->childCount();++j)
     {
         if(!active[j])
@@ -426,6 +444,7 @@ void SettingsDialog::slot_edit_series()
         if(producer->start_covering_story())
             story_item->setIcon(0, QIcon(":/images/Covering.png"));
     }
+    lane_manager->commit();
 }
 
 void SettingsDialog::start_coverage(QTreeWidgetItem* item)
@@ -449,8 +468,10 @@ void SettingsDialog::slot_start_coverage()
     {
         if(ui->tree_Series->indexOfTopLevelItem(selections[0]) != -1)
         {
+            lane_manager->begin();
             for(auto i = 0;i < selections[0]->childCount();++i)
                 start_coverage(selections[0]->child(i));
+            lane_manager->commit();
         }
         else
             start_coverage(selections[0]);
@@ -480,8 +501,10 @@ void SettingsDialog::slot_stop_coverage()
     {
         if(ui->tree_Series->indexOfTopLevelItem(selections[0]) != -1)
         {
+            lane_manager->begin();
             for(auto i = 0;i < selections[0]->childCount();++i)
                 stop_coverage(selections[0]->child(i));
+            lane_manager->commit();
         }
         else
             stop_coverage(selections[0]);
@@ -497,6 +520,7 @@ void SettingsDialog::slot_start_coverage_all()
 {
     auto changed{false};
 
+    lane_manager->begin();
     for(auto i = 0;i < ui->tree_Series->topLevelItemCount();++i)
     {
         auto series_item = ui->tree_Series->topLevelItem(i);
@@ -513,6 +537,7 @@ void SettingsDialog::slot_start_coverage_all()
             }
         }
     }
+    lane_manager->commit();
 
     if(changed)
     {
@@ -527,6 +552,7 @@ void SettingsDialog::slot_stop_coverage_all()
 {
     auto changed{false};
 
+    lane_manager->begin();
     for(auto i = 0;i < ui->tree_Series->topLevelItemCount();++i)
     {
         auto series_item = ui->tree_Series->topLevelItem(i);
@@ -543,6 +569,7 @@ void SettingsDialog::slot_stop_coverage_all()
             }
         }
     }
+    lane_manager->commit();
 
     if(changed)
     {
@@ -26,14 +26,17 @@ public:     // methods
     void            set_autostart(bool autostart);
     void            set_continue_coverage(bool continue_coverage);
     void            set_autostart_coverage(bool autostart);
+    void            set_compositing(bool composite);
     void            set_font(const QFont& font);
     void            set_styles(const HeadlineStyleList& style_list);
     void            set_stories(const QList<QString>& stories, const QList<ProducerPointer> producers);
     void            set_series(const SeriesInfoList& series_ordered);
+    void            set_lane_manager(LaneManagerPointer lane_manager);
 
     bool            get_autostart() const;
     bool            get_continue_coverage() const;
     bool            get_autostart_coverage() const;
+    bool            get_compositing() const;
     QFont           get_font();
     void            get_styles(HeadlineStyleList& style_list);
     SeriesInfoList  get_series();
@@ -72,6 +75,7 @@ private:    // data members
     Ui::SettingsDialog *ui{nullptr};
 
     ProducerMap     producers;
+    LaneManagerPointer lane_manager;    // batches the lane changes of bulk starts and stops
 
     QString         original_series_name;
     bool            editing{false};
@@ -2,6 +2,7 @@
 
 #include <QtCore/QUrl>
 #include <QtCore/QEasingCurve>
+#include <QtCore/QRegExp>
 
 #include "types.h"
 #include "specialize.h"
@@ -41,6 +42,11 @@ struct StoryInfo
                     // Notifications
     uint            ttl{5};
 
+                    //   Pending Headlines
+    int             queue_limit{0};     // 0 = unbounded
+    QueueOverflow   queue_overflow{QueueOverflow::DropOldest};
+    bool            coalesce{false};    // newer Headlines replace pending ones
+
                     // Display
     int             primary_screen{0};
 
@@ -93,6 +99,9 @@ struct StoryInfo
     QEasingCurve    motion_curve{QEasingCurve::OutCubic};
     QEasingCurve    fading_curve{QEasingCurve::InCubic};
 
+                    // Headline settings (cached; not saved)
+    QRegExp         progress_expression;    // compiled 'progress_text_re'
+
     StoryInfo() {}
     StoryInfo(const StoryInfo& source) { *this = source; }
 
@@ -121,6 +130,20 @@ struct StoryInfo
             h = static_cast<int>((headlines_percent_height / 100.0) * r_desktop.height());
         }
     }
+
+    /*!
+      Retrieves the compiled form of 'progress_text_re'.  It is compiled the
+      first time it is requested, and again only if 'progress_text_re' has
+      been changed, so all the Headlines for this Story share it.
+
+      \returns The compiled progress regular expression.
+     */
+    QRegExp& get_progress_expression()
+    {
+        if(progress_expression.pattern() != progress_text_re)
+            progress_expression = QRegExp(progress_text_re);
+        return progress_expression;
+    }
 };
 
 SPECIALIZE_SHAREDPTR(StoryInfo, StoryInfo)      // "StoryInfoPointer"
@@ -0,0 +1,33 @@
+QT += core gui widgets testlib
+
+TARGET = tst_dashboards
+TEMPLATE = app
+
+CONFIG += C++11 console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+unix:!mac {
+    QMAKE_CXXFLAGS += -Wno-reorder -Wno-switch
+}
+
+SOURCES += tst_dashboards.cpp \
+           ../../lanemanager.cpp \
+           ../../dashboard.cpp \
+           ../../chyron.cpp \
+           ../../headline.cpp \
+           ../../compositor.cpp \
+           ../../compiledstyle.cpp \
+           ../../transition.cpp \
+           ../../frameclock.cpp
+
+HEADERS += ../../lanemanager.h \
+           ../../dashboard.h \
+           ../../lanedata.h \
+           ../../chyron.h \
+           ../../headline.h \
+           ../../compositor.h \
+           ../../compiledstyle.h \
+           ../../transition.h \
+           ../../frameclock.h
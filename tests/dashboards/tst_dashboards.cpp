@@ -0,0 +1,233 @@
+#include <QtTest/QtTest>
+
+#include <QtWidgets/QApplication>
+
+#include <QtCore/QSet>
+#include <QtCore/QPointer>
+#include <QtCore/QVariantAnimation>
+
+#include "chyron.h"
+#include "lanemanager.h"
+
+// the stress layout: this many Dashboards, each holding this many Chyrons
+const int DashboardCount = 50;
+const int ChyronsPerDashboard = 20;
+const int ChyronCount = DashboardCount * ChyronsPerDashboard;
+
+// how many times the whole layout is torn down and built again
+const int SubscribeCycles = 5;
+
+// the Dashboard entry type every Chyron uses
+const AnimEntryType EntryType = AnimEntryType::DashboardDownLeftTop;
+
+/// @class TestDashboards
+/// @brief Subscribes and unsubscribes 1000 Chyrons across 50 Dashboards,
+///        checking that each lane is routed to the Dashboard managing it
+
+class TestDashboards : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void    init();
+    void    cleanup();
+
+    void    subscribe_assigns_dashboards();
+    void    anim_queue_reaches_dashboard();
+    void    graceful_unsubscribe_clears_dashboard();
+    void    immediate_unsubscribe_clears_dashboard();
+    void    subscribe_cycles();
+
+private:    // typedefs and enums
+    SPECIALIZE_LIST(ChyronPointer, Chyron)          // "ChyronList"
+    SPECIALIZE_LIST(QPointer<Dashboard>, Dashboard) // "DashboardList"
+
+private:    // methods
+    static StoryInfoPointer story(int group);
+    void    subscribe_all();
+    void    verify_subscribed();
+    void    verify_unsubscribed();
+    int     dashboards_animating() const;
+
+private:    // data members
+    LaneManagerPointer  lane_manager;
+    ChyronList          chyrons;
+    DashboardList       dashboards;     // indexed by group; null once released
+};
+
+StoryInfoPointer TestDashboards::story(int group)
+{
+    StoryInfoPointer story_info(new StoryInfo());
+    story_info->entry_type = EntryType;
+    story_info->dashboard_group_id = QString("Group %1").arg(group);
+    story_info->headlines_pixel_width = 200;
+    story_info->headlines_pixel_height = 40;
+
+    return story_info;
+}
+
+void TestDashboards::init()
+{
+    lane_manager = LaneManagerPointer(new LaneManager(QFont(), QString()));
+
+    // Chyrons are interleaved across the groups, so each Dashboard
+    // is filled a lane at a time alongside all the others
+    for(auto i = 0;i < ChyronCount;++i)
+        chyrons.append(ChyronPointer(new Chyron(story(i % DashboardCount), lane_manager)));
+
+    subscribe_all();
+}
+
+void TestDashboards::cleanup()
+{
+    // each Chyron unsubscribes itself as it is destroyed
+    chyrons.clear();
+    dashboards.clear();
+    lane_manager.clear();
+}
+
+void TestDashboards::subscribe_all()
+{
+    foreach(auto chyron, chyrons)
+        lane_manager->subscribe(chyron.data());
+
+    // the first Chyron of each group is the one that created its Dashboard
+    dashboards.clear();
+    for(auto group = 0;group < DashboardCount;++group)
+        dashboards.append(lane_manager->dashboard_for(chyrons[group].data()));
+}
+
+void TestDashboards::verify_subscribed()
+{
+    QCOMPARE(lane_manager->lane_count(), ChyronCount);
+
+    QSet<Dashboard*> unique;
+    foreach(auto dashboard, dashboards)
+    {
+        QVERIFY(dashboard);
+        QCOMPARE(dashboard->lane_count(), ChyronsPerDashboard);
+        unique.insert(dashboard.data());
+    }
+    QCOMPARE(unique.count(), DashboardCount);
+
+    for(auto i = 0;i < ChyronCount;++i)
+        QCOMPARE(lane_manager->dashboard_for(chyrons[i].data()), dashboards[i % DashboardCount].data());
+}
+
+void TestDashboards::verify_unsubscribed()
+{
+    QCOMPARE(lane_manager->lane_count(), 0);
+
+    foreach(auto chyron, chyrons)
+        QVERIFY(!lane_manager->dashboard_for(chyron.data()));
+
+    // every Dashboard is released along with its last lane
+    foreach(auto dashboard, dashboards)
+        QVERIFY(dashboard.isNull());
+}
+
+int TestDashboards::dashboards_animating() const
+{
+    auto animating{0};
+    foreach(auto dashboard, dashboards)
+    {
+        if(dashboard && dashboard->anim_in_progress())
+            ++animating;
+    }
+
+    return animating;
+}
+
+void TestDashboards::subscribe_assigns_dashboards()
+{
+    verify_subscribed();
+}
+
+void TestDashboards::anim_queue_reaches_dashboard()
+{
+    // the animation is never started; it is only queued and cleared
+    QVariantAnimation anim;
+
+    foreach(auto chyron, chyrons)
+    {
+        auto dashboard = lane_manager->dashboard_for(chyron.data());
+        QVERIFY(dashboard);
+
+        lane_manager->anim_queue(chyron.data(), &anim);
+        QVERIFY(dashboard->anim_in_progress());
+        QCOMPARE(dashboards_animating(), 1);
+
+        lane_manager->anim_clear(chyron.data());
+        QVERIFY(!dashboard->anim_in_progress());
+        QCOMPARE(dashboards_animating(), 0);
+    }
+}
+
+void TestDashboards::graceful_unsubscribe_clears_dashboard()
+{
+    // the first lane to leave each Dashboard is removed right away;
+    // the rest wait in its unsubscribe queue for the event loop
+    for(auto i = 0;i < ChyronCount;++i)
+    {
+        auto dashboard = dashboards[i % DashboardCount];
+        QCOMPARE(lane_manager->dashboard_for(chyrons[i].data()), dashboard.data());
+
+        lane_manager->unsubscribe(chyrons[i].data(), UnsubscribeAction::Graceful);
+
+        if(i < DashboardCount)
+        {
+            QVERIFY(!lane_manager->dashboard_for(chyrons[i].data()));
+            QCOMPARE(dashboard->lane_count(), ChyronsPerDashboard - 1);
+            QCOMPARE(lane_manager->lane_count(), ChyronCount - i - 1);
+        }
+    }
+
+    QTRY_COMPARE(lane_manager->lane_count(), 0);
+    verify_unsubscribed();
+}
+
+void TestDashboards::immediate_unsubscribe_clears_dashboard()
+{
+    for(auto i = 0;i < ChyronCount;++i)
+    {
+        auto dashboard = dashboards[i % DashboardCount];
+        auto last = (i >= ChyronCount - DashboardCount);
+        auto lanes = dashboard->lane_count();
+
+        lane_manager->unsubscribe(chyrons[i].data(), UnsubscribeAction::Immediate);
+
+        QVERIFY(!lane_manager->dashboard_for(chyrons[i].data()));
+        QCOMPARE(lane_manager->lane_count(), ChyronCount - i - 1);
+
+        // a Dashboard is released along with its last lane
+        QCOMPARE(dashboard.isNull(), last);
+        if(!last)
+            QCOMPARE(dashboard->lane_count(), lanes - 1);
+
+        // lanes in every other Dashboard are left alone
+        if(i + 1 < ChyronCount)
+            QCOMPARE(lane_manager->dashboard_for(chyrons[i + 1].data()), dashboards[(i + 1) % DashboardCount].data());
+    }
+
+    verify_unsubscribed();
+}
+
+void TestDashboards::subscribe_cycles()
+{
+    for(auto cycle = 0;cycle < SubscribeCycles;++cycle)
+    {
+        verify_subscribed();
+
+        foreach(auto chyron, chyrons)
+            lane_manager->unsubscribe(chyron.data());
+        verify_unsubscribed();
+
+        subscribe_all();
+    }
+
+    verify_subscribed();
+}
+
+QTEST_MAIN(TestDashboards)
+
+#include "tst_dashboards.moc"
@@ -0,0 +1,15 @@
+QT += core testlib
+QT -= gui
+
+TARGET = tst_reportsplitter
+TEMPLATE = app
+
+CONFIG += C++11 console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += tst_reportsplitter.cpp \
+           ../../reportsplitter.cpp
+
+HEADERS += ../../reportsplitter.h
@@ -0,0 +1,186 @@
+#include <QtTest/QtTest>
+
+#include <QtCore/QStringList>
+
+#include "reportsplitter.h"
+
+// how many lines are in the bursts the benchmarks split (about what a
+// TextFile Reporter delivers when a large log is appended to at once)
+const int BurstLines = 10000;
+
+/// @class TestReportSplitter
+/// @brief Checks ReportSplitter against the per-line splitting it replaced,
+///        and benchmarks both on a 10k-line burst
+
+class TestReportSplitter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void    matches_line_split_data();
+    void    matches_line_split();
+
+    void    benchmark_line_split_data();
+    void    benchmark_line_split();
+    void    benchmark_splitter_data();
+    void    benchmark_splitter();
+
+private:    // methods
+    static void         benchmark_rows();
+    static QStringList  line_split(const QByteArray& data, int limit);
+    static QStringList  splitter(const QByteArray& data, int limit);
+    static QByteArray   burst(int lines);
+};
+
+QStringList TestReportSplitter::line_split(const QByteArray& data, int limit)
+{
+    // the Producer's original approach: split the report into lines,
+    // then rebuild each Headline from them
+
+    QStringList headlines;
+
+    auto has_breaks = data.contains("<br>");
+
+    QStringList lines;
+    if(has_breaks)
+        lines = QString(data).split("<br>");
+    else
+        lines = QString(data).split('\n');
+
+    QString new_line;
+    auto current_limit{0};
+    foreach(const auto& line, lines)
+    {
+        if(new_line.length())
+        {
+            if(has_breaks)
+                new_line += "<br>";
+            else
+                new_line += "\n";
+        }
+
+        new_line += line;
+
+        ++current_limit;
+        if((current_limit % limit) == 0)
+        {
+            if(!new_line.isEmpty())
+                headlines << new_line;
+            new_line.clear();
+        }
+    }
+
+    if(!new_line.isEmpty())
+        headlines << new_line;
+
+    return headlines;
+}
+
+QStringList TestReportSplitter::splitter(const QByteArray& data, int limit)
+{
+    QStringList headlines;
+
+    ReportSplitter splitter(data, limit);
+
+    QString headline;
+    while(splitter.next(headline))
+        headlines << headline;
+
+    return headlines;
+}
+
+QByteArray TestReportSplitter::burst(int lines)
+{
+    QByteArray data;
+    for(auto i = 0;i < lines;++i)
+    {
+        if(i)
+            data += "<br>";
+        data += QString("2016-12-01 12:00:%1 [INFO] worker %2 processed batch élément #%3")
+                        .arg(i % 60, 2, 10, QChar('0'))
+                        .arg(i % 8)
+                        .arg(i)
+                        .toUtf8();
+    }
+
+    return data;
+}
+
+void TestReportSplitter::matches_line_split_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<int>("limit");
+
+    QTest::newRow("empty")              << QByteArray()                         << 2;
+    QTest::newRow("single line")        << QByteArray("one")                    << 2;
+    QTest::newRow("breaks")             << QByteArray("a<br>b<br>c<br>d<br>e")  << 2;
+    QTest::newRow("newlines")           << QByteArray("a\nb\nc\nd\ne")          << 3;
+    QTest::newRow("leading empties")    << QByteArray("<br><br>a<br>b<br>c")    << 2;
+    QTest::newRow("inner empties")      << QByteArray("a<br><br>b<br><br>c")    << 3;
+    QTest::newRow("all empties")        << QByteArray("<br><br><br>")           << 2;
+    QTest::newRow("trailing separator") << QByteArray("a\nb\n")                 << 1;
+    QTest::newRow("utf-8")              << QString("é<br>中文<br>x").toUtf8() << 2;
+    QTest::newRow("burst")              << burst(1000)                          << 7;
+}
+
+void TestReportSplitter::matches_line_split()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(int, limit);
+
+    QCOMPARE(splitter(data, limit), line_split(data, limit));
+}
+
+void TestReportSplitter::benchmark_rows()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<int>("limit");
+
+    auto data = burst(BurstLines);
+
+    QTest::newRow("1 line")     << data << 1;
+    QTest::newRow("5 lines")    << data << 5;
+    QTest::newRow("100 lines")  << data << 100;
+}
+
+void TestReportSplitter::benchmark_line_split_data()
+{
+    benchmark_rows();
+}
+
+void TestReportSplitter::benchmark_line_split()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(int, limit);
+
+    QStringList headlines;
+    QBENCHMARK
+    {
+        headlines = line_split(data, limit);
+    }
+
+    QCOMPARE(headlines.count(), (BurstLines + limit - 1) / limit);
+}
+
+void TestReportSplitter::benchmark_splitter_data()
+{
+    benchmark_rows();
+}
+
+void TestReportSplitter::benchmark_splitter()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(int, limit);
+
+    QStringList headlines;
+    QBENCHMARK
+    {
+        headlines = splitter(data, limit);
+    }
+
+    QCOMPARE(headlines.count(), (BurstLines + limit - 1) / limit);
+}
+
+QTEST_APPLESS_MAIN(TestReportSplitter)
+
+#include "tst_reportsplitter.moc"
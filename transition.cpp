@@ -0,0 +1,131 @@
+#include "headline.h"
+
+#include "transition.h"
+
+Transition::Transition(int duration, const QEasingCurve& curve, QObject *parent)
+    : QAbstractAnimation(parent),
+      track_duration(duration),
+      total_duration(duration)
+{
+    curves.append(curve);
+}
+
+void Transition::move(QWidget* widget, const QRect& start, const QRect& end)
+{
+    Track track;
+    track.widget = widget;
+    track.property = Property::Geometry;
+    track.generation = generation_of(widget);
+    track.start_geometry = start;
+    track.end_geometry = end;
+    track.duration = track_duration;
+    tracks.append(track);
+}
+
+void Transition::fade(QWidget* widget, qreal start, qreal end)
+{
+    Track track;
+    track.widget = widget;
+    track.property = Property::Opacity;
+    track.generation = generation_of(widget);
+    track.start_opacity = start;
+    track.end_opacity = end;
+    track.duration = track_duration;
+    tracks.append(track);
+}
+
+void Transition::merge(Transition* other)
+{
+    if(!other || other == this)
+        return;
+
+    Q_ASSERT(state() == QAbstractAnimation::Stopped && other->state() == QAbstractAnimation::Stopped);
+
+    tracks.reserve(tracks.count() + other->tracks.count());
+    foreach(auto track, other->tracks)
+    {
+        track.curve = add_curve(other->curves[track.curve]);
+        tracks.append(track);
+    }
+
+    total_duration = qMax(total_duration, other->total_duration);
+
+    other->tracks.clear();
+}
+
+uint Transition::generation_of(QWidget* widget)
+{
+    auto headline = qobject_cast<Headline*>(widget);
+    return headline ? headline->get_generation() : 0;
+}
+
+int Transition::duration() const
+{
+    return total_duration;
+}
+
+int Transition::add_curve(const QEasingCurve& curve)
+{
+    // Chyrons in the same Dashboard almost always share their curves
+    auto index = curves.indexOf(curve);
+    if(index != -1)
+        return index;
+
+    curves.append(curve);
+    return curves.count() - 1;
+}
+
+void Transition::updateState(QAbstractAnimation::State new_state, QAbstractAnimation::State old_state)
+{
+    if(old_state == QAbstractAnimation::Stopped && new_state == QAbstractAnimation::Running)
+    {
+        for(auto iter = tracks.begin();iter != tracks.end();++iter)
+            iter->settled = false;
+    }
+}
+
+void Transition::updateCurrentTime(int current_time)
+{
+    for(auto iter = tracks.begin();iter != tracks.end();++iter)
+    {
+        auto& track = *iter;
+        if(track.settled || track.widget.isNull())
+            continue;
+
+        // a Headline retired since the track was added now belongs to
+        // someone else (or to the HeadlinePool)
+        if(generation_of(track.widget) != track.generation)
+        {
+            track.settled = true;
+            continue;
+        }
+
+        auto progress{1.0};
+        if(track.duration > 0 && current_time < track.duration)
+            progress = curves[track.curve].valueForProgress(current_time / static_cast<qreal>(track.duration));
+        else
+            track.settled = true;
+
+        if(track.property == Property::Geometry)
+        {
+            const auto& s = track.start_geometry;
+            const auto& e = track.end_geometry;
+
+            QRect r;
+            r.setCoords(static_cast<int>(s.left() + (e.left() - s.left()) * progress),
+                        static_cast<int>(s.top() + (e.top() - s.top()) * progress),
+                        static_cast<int>(s.right() + (e.right() - s.right()) * progress),
+                        static_cast<int>(s.bottom() + (e.bottom() - s.bottom()) * progress));
+
+            // short moves spend many frames on the same pixel
+            if(track.widget->geometry() != r)
+                track.widget->setGeometry(r);
+        }
+        else
+        {
+            auto opacity = track.start_opacity + (track.end_opacity - track.start_opacity) * progress;
+            if(!qFuzzyCompare(track.widget->windowOpacity(), opacity))
+                track.widget->setWindowOpacity(opacity);
+        }
+    }
+}
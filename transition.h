@@ -0,0 +1,109 @@
+#pragma once
+
+#include <QtWidgets/QWidget>
+
+#include <QtCore/QAbstractAnimation>
+#include <QtCore/QEasingCurve>
+#include <QtCore/QPointer>
+#include <QtCore/QRect>
+
+#include "specialize.h"
+
+/// @class Transition
+/// @brief Moves and fades any number of widgets from a single animation
+///
+/// Rather than creating a QPropertyAnimation for every Headline that moves
+/// (and a QParallelAnimationGroup to run them together), each motion the
+/// Chyron or Dashboard initiates is built as one Transition holding a flat
+/// list of tracks.  Every frame, all of the tracks are evaluated and
+/// applied together, and widgets whose values have not changed since the
+/// last frame are left alone.
+///
+/// Because it is still a QAbstractAnimation, a Transition can be queued,
+/// started and deleted by the LaneManager and Dashboard just like any
+/// other animation, and it reports a single finished() for the batch.
+
+class Transition : public QAbstractAnimation
+{
+    Q_OBJECT
+public:
+    explicit Transition(int duration, const QEasingCurve& curve = QEasingCurve(), QObject *parent = nullptr);
+
+    /*!
+      These methods add a track to the Transition.  The track uses the
+      duration and easing curve the Transition was constructed with.
+      A Transition with no tracks simply runs for its duration.
+     @{
+     */
+    void    move(QWidget* widget, const QRect& start, const QRect& end);
+    void    fade(QWidget* widget, qreal start, qreal end);
+    /*!
+      @}
+     */
+
+    /*!
+      Takes all of the tracks from another (stopped) Transition, so both
+      sets of motions run as one.  Each track keeps its original duration
+      and easing curve.  The other Transition is left empty.
+
+      \param other The Transition whose tracks are to be absorbed.
+     */
+    void    merge(Transition* other);
+
+    bool    is_empty() const    { return tracks.isEmpty(); }
+
+    /*!
+      The creator of a Transition can tag it with the handle of the
+      Headline it was created for, so the Headline can be found again
+      when the Transition finishes.
+     @{
+     */
+    void    set_handle(int handle)  { this->handle = handle; }
+    int     get_handle() const      { return handle; }
+    /*!
+      @}
+     */
+
+    int     duration() const Q_DECL_OVERRIDE;
+
+protected:  // methods
+    void    updateCurrentTime(int current_time) Q_DECL_OVERRIDE;
+    void    updateState(QAbstractAnimation::State new_state, QAbstractAnimation::State old_state) Q_DECL_OVERRIDE;
+
+private:    // typedefs and enums
+    enum class Property
+    {
+        Geometry,
+        Opacity
+    };
+
+    struct Track
+    {
+        QPointer<QWidget>   widget;
+        Property            property{Property::Geometry};
+        QRect               start_geometry;
+        QRect               end_geometry;
+        qreal               start_opacity{1.0};
+        qreal               end_opacity{1.0};
+        int                 duration{0};
+        int                 curve{0};           // index into 'curves'
+        uint                generation{0};      // the Headline's generation when the track was added
+        bool                settled{false};     // end value has been applied
+    };
+
+    SPECIALIZE_VECTOR(Track, Track)                 // "TrackVector"
+    SPECIALIZE_VECTOR(QEasingCurve, Curve)          // "CurveVector"
+
+private:    // methods
+    int     add_curve(const QEasingCurve& curve);
+    static uint generation_of(QWidget* widget);
+
+private:    // data members
+    TrackVector tracks;
+    CurveVector curves;
+
+    int         track_duration{0};      // for tracks added to this Transition
+    int         total_duration{0};
+
+    int         handle{-1};
+};
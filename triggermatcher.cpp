@@ -0,0 +1,108 @@
+#include <QtCore/QQueue>
+
+#include "triggermatcher.h"
+
+void TriggerMatcher::compile(const HeadlineStyleList& style_list)
+{
+    nodes.clear();
+    styles.clear();
+    default_style = CompiledStylePointer(new CompiledStyle());
+
+    nodes.append(Node());   // root
+
+    // build the trie of case-folded triggers, remembering which style
+    // (by priority) each one selects
+
+    foreach(const auto& style, style_list)
+    {
+        if(!style.name.compare("Default"))
+        {
+            default_style = CompiledStylePointer(new CompiledStyle(style.stylesheet));
+            continue;
+        }
+
+        auto style_index = styles.count();
+        styles.append(CompiledStylePointer(new CompiledStyle(style.stylesheet)));
+
+        foreach(const auto& trigger, style.triggers)
+        {
+            auto state{0};
+            foreach(auto c, trigger.toCaseFolded())
+            {
+                auto key = c.unicode();
+                auto next = nodes[state].next.value(key, 0);
+                if(!next)
+                {
+                    next = nodes.count();
+                    nodes.append(Node());
+                    nodes[state].next[key] = next;
+                }
+                state = next;
+            }
+
+            nodes[state].style = qMin(nodes[state].style, style_index);
+        }
+    }
+
+    // breadth-first, set the failure links, and fold the styles recognized
+    // along each node's failure chain into the node itself
+
+    QQueue<int> pending;
+    foreach(auto child, nodes[0].next)
+        pending.enqueue(child);
+
+    while(!pending.isEmpty())
+    {
+        auto state = pending.dequeue();
+
+        for(auto iter = nodes[state].next.constBegin(); iter != nodes[state].next.constEnd(); ++iter)
+        {
+            auto child = iter.value();
+
+            auto fail = nodes[state].fail;
+            while(fail && !nodes[fail].next.contains(iter.key()))
+                fail = nodes[fail].fail;
+            nodes[child].fail = nodes[fail].next.value(iter.key(), 0);
+
+            nodes[child].style = qMin(nodes[child].style, nodes[nodes[child].fail].style);
+
+            pending.enqueue(child);
+        }
+    }
+}
+
+int TriggerMatcher::step(int state, ushort c) const
+{
+    for(;;)
+    {
+        auto iter = nodes[state].next.constFind(c);
+        if(iter != nodes[state].next.constEnd())
+            return iter.value();
+        if(!state)
+            return 0;
+        state = nodes[state].fail;
+    }
+}
+
+CompiledStylePointer TriggerMatcher::match(const QString& text) const
+{
+    if(nodes.isEmpty())
+        return default_style;
+
+    auto best = nodes[0].style;
+    auto state{0};
+
+    foreach(auto c, text)
+    {
+        // nothing can outrank the first style
+        if(!best)
+            break;
+
+        state = step(state, c.toCaseFolded().unicode());
+        best = qMin(best, nodes[state].style);
+    }
+
+    if(best == NoStyle)
+        return default_style;
+    return styles[best];
+}
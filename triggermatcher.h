@@ -0,0 +1,67 @@
+#pragma once
+
+#include <climits>
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QHash>
+
+#include "types.h"
+#include "specialize.h"
+#include "compiledstyle.h"
+
+/// @class TriggerMatcher
+/// @brief Selects the HeadlineStyle whose triggers appear in a Headline
+///
+/// Rather than searching each Headline for every trigger of every style,
+/// the triggers are compiled (case folded) into a single Aho-Corasick
+/// automaton whenever the style list changes, and each style's stylesheet
+/// is compiled into a shared CompiledStyle at the same time.  Selecting a
+/// style is then one linear pass over the Headline text, regardless of
+/// how many styles or triggers are defined.
+///
+/// A single TriggerMatcher is shared by all Producers.
+
+class TriggerMatcher
+{
+public:
+    /*!
+      Rebuilds the automaton from the current style list.  This must be
+      called any time the styles or their triggers are modified.
+
+      \param style_list The list of HeadlineStyles to compile.
+     */
+    void    compile(const HeadlineStyleList& style_list);
+
+    /*!
+      Returns the compiled style of the first style (in list order) that
+      has a trigger contained in the text, or the "Default" style if none
+      of them match.  Matching is case insensitive.
+
+      \param text The Headline text to examine.
+     */
+    CompiledStylePointer match(const QString& text) const;
+
+private:    // typedefs and enums
+    enum { NoStyle = INT_MAX };
+
+    struct Node
+    {
+        QHash<ushort, int>  next;
+        int                 fail{0};
+        int                 style{NoStyle};     // lowest style index recognized at this node
+    };
+
+    SPECIALIZE_VECTOR(Node, Node)               // "NodeVector"
+    SPECIALIZE_VECTOR(CompiledStylePointer, Style)  // "StyleVector"
+
+private:    // methods
+    int     step(int state, ushort c) const;
+
+private:    // data members
+    NodeVector  nodes;
+    StyleVector             styles;
+    CompiledStylePointer    default_style{new CompiledStyle()};
+};
+
+SPECIALIZE_SHAREDPTR(TriggerMatcher, TriggerMatcher)    // "TriggerMatcherPointer"
@@ -17,6 +17,7 @@ enum class AnimEntryType
 };
 
 #define IS_TRAIN(type) (type >= AnimEntryType::TrainDownLeftTop && type <= AnimEntryType::TrainUpCenterBottom)
+#define IS_POP_OR_FADE(type) (type >= AnimEntryType::FadeCenter && type <= AnimEntryType::PopRightBottom)
 #define IS_DASHBOARD(type) (type >= AnimEntryType::DashboardDownLeftTop && type <= AnimEntryType::DashboardUpRightBottom)
 
 enum class AnimExitType
@@ -46,6 +47,13 @@ enum class UnsubscribeAction
     Graceful
 };
 
+enum class QueueOverflow
+{
+    DropOldest,
+    DropNewest,
+    Summarize
+};
+
 SPECIALIZE_SHAREDPTR(QPluginLoader, Factory)            // "FactoryPointer"
 
 struct ReporterInfo
@@ -75,5 +83,5 @@ SPECIALIZE_SHAREDPTR(HeadlineStyleList, StyleList)      // "StyleListPointer"
 SPECIALIZE_PAIR(QString, QStringList, Series)           // "SeriesPair"
 SPECIALIZE_LIST(SeriesPair, Series)                     // "SeriesList"
 
-class QPropertyAnimation;
-SPECIALIZE_SHAREDPTR(QPropertyAnimation, Animation)     // "AnimationPointer"
+class Transition;
+SPECIALIZE_SHAREDPTR(Transition, Animation)             // "AnimationPointer"